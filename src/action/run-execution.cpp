@@ -25,6 +25,8 @@
 #include "system/player-type-definition.h"
 #include "util/bit-flags-calculator.h"
 #include "view/display-messages.h"
+#include <array>
+#include <optional>
 
 bool ignore_avoid_run;
 
@@ -192,6 +194,54 @@ static bool see_nothing(PlayerType *player_ptr, DIRECTION dir, POSITION y, POSIT
     return true;
 }
 
+/*!
+ * @brief 1歩分の走行判定の間、プレイヤーの周囲のマスについての判定結果を使い回す
+ * @details
+ * 周囲のマスが既知の壁かどうかは、分岐の探索・開けた場所での壁の切れ目の確認・進行方向の確認で
+ * 同じマスについて繰り返し調べられるため、最初に調べた時の結果を覚えておく。
+ * 判定の途中で地形・マスの記憶・プレイヤーの状態は変わらないので、結果も変わらない。
+ */
+class RunNeighbourhood {
+public:
+    RunNeighbourhood(PlayerType *player_ptr)
+        : player_ptr(player_ptr)
+    {
+    }
+
+    /*!
+     * @brief プレイヤーの隣のマスが既知の壁かどうかを判定する
+     * @param dir 隣のマスの方向ID
+     * @return 既知の壁ならばTRUE
+     */
+    bool see_wall(DIRECTION dir)
+    {
+        auto &wall = this->walls[dir];
+        if (!wall.has_value()) {
+            wall = ::see_wall(this->player_ptr, dir, this->player_ptr->y, this->player_ptr->x);
+        }
+
+        return *wall;
+    }
+
+    /*!
+     * @brief 深い水の地形を気にせず走れるかどうかを判定する
+     * @return 浮遊・泳ぎ・重量制限内のいずれかならばTRUE
+     */
+    bool can_cross_deep_water()
+    {
+        if (!this->deep_water.has_value()) {
+            this->deep_water = this->player_ptr->levitation || this->player_ptr->can_swim || (calc_inventory_weight(this->player_ptr) <= calc_weight_limit(this->player_ptr));
+        }
+
+        return *this->deep_water;
+    }
+
+private:
+    PlayerType *player_ptr;
+    std::array<std::optional<bool>, 10> walls{}; //!< 方向IDごとの隣のマスが既知の壁かどうか
+    std::optional<bool> deep_water; //!< 深い水の地形を気にせず走れるかどうか
+};
+
 /*!
  * @brief ダッシュ移動が継続できるかどうかの判定 /
  * Update the current "run" path
@@ -219,6 +269,7 @@ static bool run_test(PlayerType *player_ptr)
         }
     }
 
+    RunNeighbourhood neighbourhood(player_ptr);
     DIRECTION check_dir = 0;
     int option = 0, option2 = 0;
     for (int i = -max; i <= max; i++) {
@@ -255,7 +306,7 @@ static bool run_test(PlayerType *player_ptr)
                     notice = false;
                 } else if (f_ptr->flags.has(FloorFeatureType::LAVA) && (has_immune_fire(player_ptr) || is_invuln(player_ptr))) {
                     notice = false;
-                } else if (f_ptr->flags.has_all_of({ FloorFeatureType::WATER, FloorFeatureType::DEEP }) && (player_ptr->levitation || player_ptr->can_swim || (calc_inventory_weight(player_ptr) <= calc_weight_limit(player_ptr)))) {
+                } else if (f_ptr->flags.has_all_of({ FloorFeatureType::WATER, FloorFeatureType::DEEP }) && neighbourhood.can_cross_deep_water()) {
                     notice = false;
                 }
             }
@@ -267,7 +318,7 @@ static bool run_test(PlayerType *player_ptr)
             inv = false;
         }
 
-        if (!inv && see_wall(player_ptr, 0, row, col)) {
+        if (!inv && neighbourhood.see_wall(new_dir)) {
             if (find_openarea) {
                 if (i < 0) {
                     find_breakright = true;
@@ -309,7 +360,7 @@ static bool run_test(PlayerType *player_ptr)
 
     if (find_openarea) {
         for (int i = -max; i < 0; i++) {
-            if (!see_wall(player_ptr, cycle[chome[prev_dir] + i], player_ptr->y, player_ptr->x)) {
+            if (!neighbourhood.see_wall(cycle[chome[prev_dir] + i])) {
                 if (find_breakright) {
                     return true;
                 }
@@ -321,7 +372,7 @@ static bool run_test(PlayerType *player_ptr)
         }
 
         for (int i = max; i > 0; i--) {
-            if (!see_wall(player_ptr, cycle[chome[prev_dir] + i], player_ptr->y, player_ptr->x)) {
+            if (!neighbourhood.see_wall(cycle[chome[prev_dir] + i])) {
                 if (find_breakleft) {
                     return true;
                 }
@@ -332,7 +383,7 @@ static bool run_test(PlayerType *player_ptr)
             }
         }
 
-        return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+        return neighbourhood.see_wall(find_current);
     }
 
     if (!option) {
@@ -342,11 +393,11 @@ static bool run_test(PlayerType *player_ptr)
     if (!option2) {
         find_current = option;
         find_prevdir = option;
-        return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+        return neighbourhood.see_wall(find_current);
     } else if (!find_cut) {
         find_current = option;
         find_prevdir = option2;
-        return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+        return neighbourhood.see_wall(find_current);
     }
 
     int row = player_ptr->y + ddy[option];
@@ -355,7 +406,7 @@ static bool run_test(PlayerType *player_ptr)
         if (see_nothing(player_ptr, option, row, col) && see_nothing(player_ptr, option2, row, col)) {
             find_current = option;
             find_prevdir = option2;
-            return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+            return neighbourhood.see_wall(find_current);
         }
 
         return true;
@@ -364,12 +415,12 @@ static bool run_test(PlayerType *player_ptr)
     if (find_cut) {
         find_current = option2;
         find_prevdir = option2;
-        return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+        return neighbourhood.see_wall(find_current);
     }
 
     find_current = option;
     find_prevdir = option2;
-    return see_wall(player_ptr, find_current, player_ptr->y, player_ptr->x);
+    return neighbourhood.see_wall(find_current);
 }
 
 /*!
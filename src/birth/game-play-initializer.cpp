@@ -1,6 +1,7 @@
 ﻿#include "birth/game-play-initializer.h"
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
+#include "flavor/flavor-describer.h"
 #include "floor/floor-util.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-options.h"
@@ -35,6 +36,8 @@ static void k_info_reset(void)
         k_ref.tried = false;
         k_ref.aware = false;
     }
+
+    invalidate_object_descriptions();
 }
 
 /*!
@@ -1,6 +1,7 @@
 ﻿#include "birth/inventory-initializer.h"
 #include "autopick/autopick.h"
 #include "birth/initial-equipments-table.h"
+#include "flavor/flavor-describer.h"
 #include "floor/floor-object.h"
 #include "inventory/inventory-object.h"
 #include "inventory/inventory-slot-types.h"
@@ -280,4 +281,5 @@ void player_outfit(PlayerType *player_ptr)
     }
 
     k_info[lookup_kind(ItemKindType::POTION, SV_POTION_WATER)].aware = true;
+    invalidate_object_descriptions();
 }
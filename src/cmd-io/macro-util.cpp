@@ -1,4 +1,5 @@
 ﻿#include "cmd-io/macro-util.h"
+#include <map>
 
 /* Current macro action [1024] */
 std::vector<char> macro__buf;
@@ -15,45 +16,90 @@ int16_t macro__num;
 /* Expand macros in "get_com" or not */
 bool get_com_no_macros = false;
 
-/* Determine if any macros have ever started with a given character */
-static bool macro__use[256];
-
-/* Find the macro (if any) which exactly matches the given pattern */
-int macro_find_exact(concptr pat)
+/*!
+ * @brief マクロのトリガー文字列を引くためのトライ木の節
+ */
+struct macro_trie_node {
+    std::map<char, int> children; //!< 次の文字ごとの子の節の位置
+    int macro_idx = -1; //!< この節でちょうど終わるマクロの番号 (なければ-1)
+    int first_idx = -1; //!< この節以下 (この節を含む) で終わるマクロの最小の番号 (なければ-1)
+};
+
+/* Trie of all macro patterns, the root is always at index 0 */
+static std::vector<macro_trie_node> macro__trie(1);
+
+/*!
+ * @brief トリガー文字列に対応する節を探す
+ * @param pat トリガー文字列
+ * @return 節の位置、どのマクロもその文字列で始まらない (または空文字列) ならば-1
+ */
+static int macro_trie_find(concptr pat)
 {
-    if (!macro__use[(byte)(pat[0])]) {
+    if (!pat[0]) {
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!streq(macro__pat[i], pat)) {
-            continue;
+    auto node = 0;
+    for (auto p = pat; *p; p++) {
+        const auto &children = macro__trie[node].children;
+        const auto it = children.find(*p);
+        if (it == children.end()) {
+            return -1;
         }
 
-        return i;
+        node = it->second;
     }
 
-    return -1;
+    return node;
 }
 
-/*
- * Find the first macro (if any) which contains the given pattern
+/*!
+ * @brief トライ木にマクロを登録する
+ * @param pat トリガー文字列
+ * @param macro_idx マクロの番号
+ * @details マクロの番号は登録順に増えるので、経路上の最小の番号は最初に設定したものから変わらない
  */
-int macro_find_check(concptr pat)
+static void macro_trie_insert(concptr pat, int macro_idx)
 {
-    if (!macro__use[(byte)(pat[0])]) {
-        return -1;
-    }
+    auto node = 0;
+    for (auto p = pat;; p++) {
+        if (macro__trie[node].first_idx < 0) {
+            macro__trie[node].first_idx = macro_idx;
+        }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat)) {
+        if (!*p) {
+            break;
+        }
+
+        const auto it = macro__trie[node].children.find(*p);
+        if (it != macro__trie[node].children.end()) {
+            node = it->second;
             continue;
         }
 
-        return i;
+        const auto child = static_cast<int>(macro__trie.size());
+        macro__trie[node].children.emplace(*p, child);
+        macro__trie.emplace_back();
+        node = child;
     }
 
-    return -1;
+    macro__trie[node].macro_idx = macro_idx;
+}
+
+/* Find the macro (if any) which exactly matches the given pattern */
+int macro_find_exact(concptr pat)
+{
+    const auto node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].macro_idx;
+}
+
+/*
+ * Find the first macro (if any) which contains the given pattern
+ */
+int macro_find_check(concptr pat)
+{
+    const auto node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].first_idx;
 }
 
 /*
@@ -61,22 +107,20 @@ int macro_find_check(concptr pat)
  */
 int macro_find_maybe(concptr pat)
 {
-    if (!macro__use[(byte)(pat[0])]) {
+    const auto node = macro_trie_find(pat);
+    if (node < 0) {
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat)) {
-            continue;
-        }
-        if (streq(macro__pat[i], pat)) {
-            continue;
+    auto first_idx = -1;
+    for (const auto &[c, child] : macro__trie[node].children) {
+        const auto idx = macro__trie[child].first_idx;
+        if ((idx >= 0) && ((first_idx < 0) || (idx < first_idx))) {
+            first_idx = idx;
         }
-
-        return i;
     }
 
-    return -1;
+    return first_idx;
 }
 
 /*
@@ -84,24 +128,19 @@ int macro_find_maybe(concptr pat)
  */
 int macro_find_ready(concptr pat)
 {
-    int t, n = -1, s = -1;
-
-    if (!macro__use[(byte)(pat[0])]) {
-        return -1;
-    }
-
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(pat, macro__pat[i])) {
-            continue;
+    auto node = 0;
+    auto n = macro__trie[node].macro_idx;
+    for (auto p = pat; *p; p++) {
+        const auto &children = macro__trie[node].children;
+        const auto it = children.find(*p);
+        if (it == children.end()) {
+            break;
         }
 
-        t = macro__pat[i].size();
-        if ((n >= 0) && (s > t)) {
-            continue;
+        node = it->second;
+        if (macro__trie[node].macro_idx >= 0) {
+            n = macro__trie[node].macro_idx;
         }
-
-        n = i;
-        s = t;
     }
 
     return n;
@@ -134,9 +173,9 @@ errr macro_add(concptr pat, concptr act)
     if (n < 0) {
         n = macro__num++;
         macro__pat[n] = pat;
+        macro_trie_insert(pat, n);
     }
 
     macro__act[n] = act;
-    macro__use[(byte)(pat[0])] = true;
     return 0;
 }
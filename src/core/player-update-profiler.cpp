@@ -0,0 +1,101 @@
+﻿/*!
+ * @brief 更新処理の計測 / Profiling of player update passes
+ * @date 2026/10/19
+ * @details
+ * handle_stuff() が行う更新処理ごとに実行回数と所要時間を集計し、
+ * 1ゲームターン当たりで最も重い処理を見つけられるようにする。
+ */
+
+#include "core/player-update-profiler.h"
+#include "system/gamevalue.h"
+#include "world/world.h"
+#include <algorithm>
+
+namespace {
+
+/*!
+ * @brief 更新処理の名前 (UpdatePassType の並び順)
+ */
+const std::array<concptr, enum2i(UpdatePassType::MAX)> UPDATE_PASS_NAMES = { {
+    "AUTODESTROY",
+    "COMBINE",
+    "REORDER",
+    "BONUS",
+    "TORCH",
+    "HP",
+    "MANA",
+    "SPELLS",
+    "UN_LITE",
+    "UN_VIEW",
+    "VIEW",
+    "LITE",
+    "FLOW",
+    "DISTANCE",
+    "MON_LITE",
+    "DELAY_VIS",
+    "MONSTERS",
+    "REDRAW",
+    "WINDOW",
+} };
+
+}
+
+PlayerUpdateProfiler &PlayerUpdateProfiler::get_instance()
+{
+    static PlayerUpdateProfiler instance{};
+    return instance;
+}
+
+/*!
+ * @brief 更新処理の実行を1回記録する
+ * @param pass 更新処理
+ * @param elapsed 所要時間
+ */
+void PlayerUpdateProfiler::record(UpdatePassType pass, std::chrono::nanoseconds elapsed)
+{
+    auto &counter = this->counters[enum2i(pass)];
+    counter.calls++;
+    counter.elapsed += elapsed;
+}
+
+/*!
+ * @brief 他の更新処理に含まれるため省略したことを記録する
+ * @param pass 省略した更新処理
+ */
+void PlayerUpdateProfiler::record_coalesced(UpdatePassType pass)
+{
+    this->counters[enum2i(pass)].coalesced++;
+}
+
+/*!
+ * @brief 集計値を消去し、現在のゲームターンから集計し直す
+ */
+void PlayerUpdateProfiler::reset()
+{
+    this->counters.fill({});
+    this->start_turn = w_ptr->game_turn;
+}
+
+/*!
+ * @brief 集計結果を所要時間の多い順に書き出す
+ * @param fp 出力先
+ */
+void PlayerUpdateProfiler::dump(FILE *fp) const
+{
+    const auto ticks = std::max<GAME_TURN>((w_ptr->game_turn - this->start_turn) / TURNS_PER_TICK, 1);
+    std::array<int, enum2i(UpdatePassType::MAX)> order{};
+    for (auto i = 0; i < enum2i(UpdatePassType::MAX); i++) {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) { return this->counters[a].elapsed > this->counters[b].elapsed; });
+    fprintf(fp, "Game turns: %d (%d ticks)\n\n", w_ptr->game_turn - this->start_turn, ticks);
+    fprintf(fp, "%-12s %10s %10s %10s %12s %10s\n", "Pass", "Calls", "Coalesced", "Calls/tick", "Total(ms)", "Avg(us)");
+    for (const auto i : order) {
+        const auto &counter = this->counters[i];
+        const auto total_usecs = std::chrono::duration<double, std::micro>(counter.elapsed).count();
+        fprintf(fp, "%-12s %10llu %10llu %10.2f %12.2f %10.2f\n", UPDATE_PASS_NAMES[i],
+            static_cast<unsigned long long>(counter.calls), static_cast<unsigned long long>(counter.coalesced),
+            static_cast<double>(counter.calls) / ticks, total_usecs / 1000.0, counter.calls ? total_usecs / counter.calls : 0.0);
+    }
+}
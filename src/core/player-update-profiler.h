@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "util/enum-converter.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+
+/*!
+ * @brief 計測対象の更新処理 (handle_stuff() で実行される順)
+ */
+enum class UpdatePassType : int {
+    AUTODESTROY = 0,
+    COMBINE,
+    REORDER,
+    BONUS,
+    TORCH,
+    HP,
+    MANA,
+    SPELLS,
+    UN_LITE,
+    UN_VIEW,
+    VIEW,
+    LITE,
+    FLOW,
+    DISTANCE,
+    MON_LITE,
+    DELAY_VIS,
+    MONSTERS,
+    REDRAW,
+    WINDOW,
+    MAX,
+};
+
+/*!
+ * @brief 更新処理ごとの実行回数と所要時間を集計する
+ */
+class PlayerUpdateProfiler final {
+public:
+    static PlayerUpdateProfiler &get_instance();
+    void record(UpdatePassType pass, std::chrono::nanoseconds elapsed);
+    void record_coalesced(UpdatePassType pass);
+    void reset();
+    void dump(FILE *fp) const;
+    PlayerUpdateProfiler(const PlayerUpdateProfiler &) = delete;
+    PlayerUpdateProfiler(PlayerUpdateProfiler &&) = delete;
+    PlayerUpdateProfiler &operator=(const PlayerUpdateProfiler &) = delete;
+    PlayerUpdateProfiler &operator=(PlayerUpdateProfiler &&) = delete;
+
+private:
+    /*!
+     * @brief 更新処理1つ分の集計値
+     */
+    struct pass_counter {
+        uint64_t calls = 0; //!< 実行回数
+        uint64_t coalesced = 0; //!< 他の処理に含まれるため省略した回数
+        std::chrono::nanoseconds elapsed{}; //!< 所要時間の合計
+    };
+
+    std::array<pass_counter, enum2i(UpdatePassType::MAX)> counters{};
+    GAME_TURN start_turn = 0; //!< 集計を開始したゲームターン
+    PlayerUpdateProfiler() = default;
+    ~PlayerUpdateProfiler() = default;
+};
+
+/*!
+ * @brief 更新処理を1回実行し、所要時間を集計する
+ * @param pass 計測対象の更新処理
+ * @param process 更新処理
+ */
+template <typename Process>
+void profile_update_pass(UpdatePassType pass, Process process)
+{
+    const auto start = std::chrono::steady_clock::now();
+    process();
+    PlayerUpdateProfiler::get_instance().record(pass, std::chrono::steady_clock::now() - start);
+}
@@ -1,5 +1,6 @@
 ﻿#include "core/score-util.h"
 #include "util/angband-files.h"
+#include <algorithm>
 
 /*
  * The "highscore" file descriptor, if available.
@@ -7,21 +8,110 @@
 int highscore_fd = -1;
 
 /*!
- * @brief i番目のスコア情報にバッファ位置をシークする / Seek score 'i' in the highscore file
- * @param i スコア情報ID
- * @return 問題がなければ0を返す
+ * @brief スコアファイルの全記録を読み込む / Read the whole highscore file
+ * @return エラーコード
  */
-int highscore_seek(int i)
+errr HighScoreList::load()
 {
-    return fd_seek(highscore_fd, (ulong)(i) * sizeof(high_score));
+    this->scores.clear();
+    this->race_ranks.clear();
+    if (fd_seek(highscore_fd, 0)) {
+        return -1;
+    }
+
+    this->scores.resize(MAX_HISCORES);
+    auto bytes = read(highscore_fd, reinterpret_cast<char *>(this->scores.data()), sizeof(high_score) * MAX_HISCORES);
+    if (bytes < 0) {
+        this->scores.clear();
+        return -1;
+    }
+
+    this->scores.resize(bytes / sizeof(high_score));
+    this->build_indices();
+    return 0;
 }
 
 /*!
- * @brief 所定ポインタからスコア情報を読み取る / Read one score from the highscore file
- * @param score スコア情報参照ポインタ
- * @return エラーコード
+ * @brief 記録の数を返す
+ * @return 記録の数
+ */
+int HighScoreList::size() const
+{
+    return static_cast<int>(this->scores.size());
+}
+
+/*!
+ * @brief 指定した順位の記録を返す
+ * @param rank 順位 (0が最高位)
+ * @return スコア情報
+ */
+const high_score &HighScoreList::get(int rank) const
+{
+    return this->scores.at(rank);
+}
+
+/*!
+ * @brief 新しい記録が入る位置を求める / Just determine where a new score *would* be placed
+ * @param score スコア情報
+ * @return 挿入位置 (記録が満杯で最下位より低い得点の場合も、最後の位置は常に使える)
+ * @details 同点の場合は既存の記録の後ろに入る
+ */
+int HighScoreList::find_slot(const high_score &score) const
+{
+    const auto my_score = atoi(score.pts);
+    const auto it = std::partition_point(this->scores.begin(), this->scores.end(), [my_score](const auto &the_score) { return atoi(the_score.pts) >= my_score; });
+    return std::min(static_cast<int>(std::distance(this->scores.begin(), it)), MAX_HISCORES - 1);
+}
+
+/*!
+ * @brief 指定した種族の記録の順位を返す
+ * @param race 種族ID
+ * @return 順位の昇順に並んだ配列
+ */
+const std::vector<int> &HighScoreList::get_race_ranks(int race) const
+{
+    static const std::vector<int> empty_ranks;
+    const auto it = this->race_ranks.find(race);
+    return (it == this->race_ranks.end()) ? empty_ranks : it->second;
+}
+
+/*!
+ * @brief 記録を追加し、スコアファイルへ書き込む / Actually place an entry into the high score file
+ * @param score スコア情報
+ * @return 正常ならば書き込んだスロット位置、問題があれば-1を返す / Return the location (0 is best) or -1 on "failure"
+ * @details 挿入位置以降の記録を1つずつずらした内容を1回で書き戻す。溢れた最下位の記録は消える
+ */
+int HighScoreList::add(const high_score &score)
+{
+    if (highscore_fd < 0) {
+        return -1;
+    }
+
+    const auto slot = this->find_slot(score);
+    this->scores.insert(this->scores.begin() + slot, score);
+    if (this->scores.size() > MAX_HISCORES) {
+        this->scores.resize(MAX_HISCORES);
+    }
+
+    this->build_indices();
+    if (fd_seek(highscore_fd, static_cast<ulong>(slot) * sizeof(high_score))) {
+        return -1;
+    }
+
+    if (fd_write(highscore_fd, reinterpret_cast<char *>(&this->scores[slot]), (this->scores.size() - slot) * sizeof(high_score))) {
+        return -1;
+    }
+
+    return slot;
+}
+
+/*!
+ * @brief 種族ごとの順位の索引を作り直す
  */
-errr highscore_read(high_score *score)
+void HighScoreList::build_indices()
 {
-    return fd_read(highscore_fd, (char *)(score), sizeof(high_score));
+    this->race_ranks.clear();
+    for (auto i = 0; i < this->size(); i++) {
+        this->race_ranks[atoi(this->scores[i].p_r)].push_back(i);
+    }
 }
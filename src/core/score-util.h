@@ -1,6 +1,8 @@
 ﻿#pragma once
 
 #include "system/angband.h"
+#include <map>
+#include <vector>
 
 #define MAX_HISCORES 999 /*!< スコア情報保存の最大数 / Maximum number of high scores in the high score file */
 
@@ -35,7 +37,29 @@ struct high_score {
     GAME_TEXT how[40]; /* Method of death (string) */
 };
 
-extern int highscore_fd;
+/*!
+ * @brief スコアファイルの全記録をメモリ上に読み込み、順位と種族で引けるようにしたもの
+ * @details
+ * スコアファイルは得点の降順に並んだ high_score の配列そのもので、記録の形式は従来と変わらない。
+ * 読み込みは1回の read で済ませ、追加は挿入位置以降をずらした内容を1回の write で書き戻す。
+ * 複数のプレイヤーが同時に書き込む環境では、fd_lock() で排他してから load() と add() を呼ぶこと。
+ */
+class HighScoreList {
+public:
+    HighScoreList() = default;
+
+    errr load();
+    int size() const;
+    const high_score &get(int rank) const;
+    int find_slot(const high_score &score) const;
+    const std::vector<int> &get_race_ranks(int race) const;
+    int add(const high_score &score);
+
+private:
+    std::vector<high_score> scores; //!< 得点の降順に並んだ記録
+    std::map<int, std::vector<int>> race_ranks; //!< 種族ごとの順位 (昇順)
 
-int highscore_seek(int i);
-errr highscore_read(high_score *score);
+    void build_indices();
+};
+
+extern int highscore_fd;
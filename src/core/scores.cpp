@@ -42,103 +42,6 @@
 #include "view/display-scores.h"
 #include "world/world.h"
 
-/*!
- * @brief 所定ポインタへスコア情報を書き込む / Write one score to the highscore file
- * @param score スコア情報参照ポインタ
- * @return エラーコード(問題がなければ0を返す)
- */
-static int highscore_write(high_score *score)
-{
-    /* Write the record, note failure */
-    return fd_write(highscore_fd, (char *)(score), sizeof(high_score));
-}
-
-/*!
- * @brief スコア情報を全て得るまで繰り返し取得する / Just determine where a new score *would* be placed
- * @param score スコア情報参照ポインタ
- * @return 正常ならば(MAX_HISCORES - 1)、問題があれば-1を返す
- */
-static int highscore_where(high_score *score)
-{
-    /* Paranoia -- it may not have opened */
-    if (highscore_fd < 0) {
-        return -1;
-    }
-
-    /* Go to the start of the highscore file */
-    if (highscore_seek(0)) {
-        return -1;
-    }
-
-    /* Read until we get to a higher score */
-    high_score the_score;
-    int my_score = atoi(score->pts);
-    for (int i = 0; i < MAX_HISCORES; i++) {
-        int old_score;
-        if (highscore_read(&the_score)) {
-            return i;
-        }
-        old_score = atoi(the_score.pts);
-        if (my_score > old_score) {
-            return i;
-        }
-    }
-
-    /* The "last" entry is always usable */
-    return MAX_HISCORES - 1;
-}
-
-/*!
- * @brief スコア情報をバッファの末尾に追加する / Actually place an entry into the high score file
- * @param score スコア情報参照ポインタ
- * @return 正常ならば書き込んだスロット位置、問題があれば-1を返す / Return the location (0 is best) or -1 on "failure"
- */
-static int highscore_add(high_score *score)
-{
-    /* Paranoia -- it may not have opened */
-    if (highscore_fd < 0) {
-        return -1;
-    }
-
-    /* Determine where the score should go */
-    int slot = highscore_where(score);
-
-    /* Hack -- Not on the list */
-    if (slot < 0) {
-        return -1;
-    }
-
-    /* Hack -- prepare to dump the new score */
-    high_score the_score = (*score);
-
-    /* Slide all the scores down one */
-    bool done = false;
-    high_score tmpscore;
-    for (int i = slot; !done && (i < MAX_HISCORES); i++) {
-        /* Read the old guy, note errors */
-        if (highscore_seek(i)) {
-            return -1;
-        }
-        if (highscore_read(&tmpscore)) {
-            done = true;
-        }
-
-        /* Back up and dump the score we were holding */
-        if (highscore_seek(i)) {
-            return -1;
-        }
-        if (highscore_write(&the_score)) {
-            return -1;
-        }
-
-        /* Hack -- Save the old score, for the next pass */
-        the_score = tmpscore;
-    }
-
-    /* Return location used */
-    return slot;
-}
-
 /*!
  * @brief スコアサーバへの転送処理
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -257,7 +160,8 @@ errr top_twenty(PlayerType *player_ptr)
     }
 
     /* Add a new entry to the score list, see where it went */
-    int j = highscore_add(&the_score);
+    HighScoreList scores;
+    int j = scores.load() ? -1 : scores.add(the_score);
 
     /* Grab permissions */
     safe_setuid_grab(player_ptr);
@@ -339,7 +243,9 @@ errr predict_score(PlayerType *player_ptr)
     strcpy(the_score.how, _("yet", "nobody (yet!)"));
 
     /* See where the entry would be placed */
-    int j = highscore_where(&the_score);
+    HighScoreList scores;
+    (void)scores.load();
+    int j = scores.find_slot(the_score);
 
     /* Hack -- Display the top fifteen scores */
     if (j < 10) {
@@ -370,30 +276,13 @@ void show_highclass(PlayerType *player_ptr)
         return;
     }
 
-    if (highscore_seek(0)) {
-        return;
-    }
-
-    high_score the_score;
-    for (int i = 0; i < MAX_HISCORES; i++) {
-        if (highscore_read(&the_score)) {
-            break;
-        }
-    }
-
+    HighScoreList scores;
+    (void)scores.load();
     int m = 0;
-    int j = 0;
-    PLAYER_LEVEL clev = 0;
-    int pr;
-    while ((m < 9) && (j < MAX_HISCORES)) {
-        if (highscore_seek(j)) {
-            break;
-        }
-        if (highscore_read(&the_score)) {
-            break;
-        }
-        pr = atoi(the_score.p_r);
-        clev = (PLAYER_LEVEL)atoi(the_score.cur_lev);
+    for (; (m < 9) && (m < scores.size()); m++) {
+        const auto &the_score = scores.get(m);
+        int pr = atoi(the_score.p_r);
+        PLAYER_LEVEL clev = (PLAYER_LEVEL)atoi(the_score.cur_lev);
 
 #ifdef JP
         sprintf(out_val, "   %3d) %sの%s (レベル %2d)", (m + 1), race_info[pr].title, the_score.who, clev);
@@ -402,8 +291,6 @@ void show_highclass(PlayerType *player_ptr)
 #endif
 
         prt(out_val, (m + 7), 0);
-        m++;
-        j++;
     }
 
 #ifdef JP
@@ -420,7 +307,7 @@ void show_highclass(PlayerType *player_ptr)
 
     (void)inkey();
 
-    for (j = 5; j < 18; j++) {
+    for (int j = 5; j < 18; j++) {
         prt("", j, 0);
     }
     screen_load();
@@ -433,9 +320,8 @@ void show_highclass(PlayerType *player_ptr)
  */
 void race_score(PlayerType *player_ptr, int race_num)
 {
-    int i = 0, j, m = 0;
-    int pr, clev, lastlev;
-    high_score the_score;
+    int m = 0;
+    int clev, lastlev;
     char buf[1024], out_val[256], tmp_str[80];
 
     lastlev = 0;
@@ -454,41 +340,20 @@ void race_score(PlayerType *player_ptr, int race_num)
         return;
     }
 
-    if (highscore_seek(0)) {
-        return;
-    }
-
-    for (i = 0; i < MAX_HISCORES; i++) {
-        if (highscore_read(&the_score)) {
-            break;
-        }
-    }
-
-    m = 0;
-    j = 0;
-
-    while ((m < 10) || (j < MAX_HISCORES)) {
-        if (highscore_seek(j)) {
-            break;
-        }
-        if (highscore_read(&the_score)) {
-            break;
-        }
-        pr = atoi(the_score.p_r);
+    HighScoreList scores;
+    (void)scores.load();
+    for (auto j : scores.get_race_ranks(race_num)) {
+        const auto &the_score = scores.get(j);
         clev = atoi(the_score.cur_lev);
-
-        if (pr == race_num) {
 #ifdef JP
-            sprintf(out_val, "   %3d) %sの%s (レベル %2d)", (m + 1), race_info[pr].title, the_score.who, clev);
+        sprintf(out_val, "   %3d) %sの%s (レベル %2d)", (m + 1), race_info[race_num].title, the_score.who, clev);
 #else
-            sprintf(out_val, "%3d) %s the %s (Level %3d)", (m + 1), the_score.who, race_info[pr].title, clev);
+        sprintf(out_val, "%3d) %s the %s (Level %3d)", (m + 1), the_score.who, race_info[race_num].title, clev);
 #endif
 
-            prt(out_val, (m + 7), 0);
-            m++;
-            lastlev = clev;
-        }
-        j++;
+        prt(out_val, (m + 7), 0);
+        m++;
+        lastlev = clev;
     }
 
     /* add player if qualified */
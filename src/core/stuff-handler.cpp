@@ -1,5 +1,6 @@
 ﻿#include "core/stuff-handler.h"
 #include "core/player-redraw-types.h"
+#include "core/player-update-profiler.h"
 #include "core/player-update-types.h"
 #include "core/window-redrawer.h"
 #include "player/player-status.h"
@@ -15,10 +16,10 @@ void handle_stuff(PlayerType *player_ptr)
         update_creature(player_ptr);
     }
     if (player_ptr->redraw) {
-        redraw_stuff(player_ptr);
+        profile_update_pass(UpdatePassType::REDRAW, [player_ptr] { redraw_stuff(player_ptr); });
     }
     if (player_ptr->window_flags) {
-        window_stuff(player_ptr);
+        profile_update_pass(UpdatePassType::WINDOW, [player_ptr] { window_stuff(player_ptr); });
     }
 }
 
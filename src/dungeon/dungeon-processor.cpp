@@ -44,6 +44,26 @@
 #include "world/world-turn-processor.h"
 #include "world/world.h"
 
+static TurnPhaseObserver turn_phase_observer;
+
+/*!
+ * @brief ゲームターン内の処理を1つ実行し、計測用フックがあれば所要時間を通知する
+ * @param phase 処理の区分
+ * @param process 処理本体
+ */
+template <typename Process>
+static void measure_turn_phase(TurnPhase phase, Process &&process)
+{
+    if (!turn_phase_observer) {
+        process();
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    process();
+    turn_phase_observer(phase, std::chrono::steady_clock::now() - start);
+}
+
 /*!
  * process_player()、process_world() をcore.c から移設するのが先.
  * process_upkeep_with_speed() はこの関数と同じところでOK
@@ -167,6 +187,7 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
     mproc_init(floor_ptr);
 
     while (true) {
+        const auto turn_start = turn_phase_observer ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
         if ((floor_ptr->m_cnt + 32 > w_ptr->max_m_idx) && !player_ptr->phase_out) {
             compact_monsters(player_ptr, 64);
         }
@@ -183,37 +204,37 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
             compact_objects(player_ptr, 0);
         }
 
-        process_player(player_ptr);
+        measure_turn_phase(TurnPhase::PLAYER, [player_ptr] { process_player(player_ptr); });
         process_upkeep_with_speed(player_ptr);
-        handle_stuff(player_ptr);
+        measure_turn_phase(TurnPhase::HANDLE_STUFF, [player_ptr] { handle_stuff(player_ptr); });
 
         move_cursor_relative(player_ptr->y, player_ptr->x);
         if (fresh_after) {
-            term_fresh_force();
+            measure_turn_phase(TurnPhase::TERM_FRESH, term_fresh_force);
         }
 
         if (!player_ptr->playing || player_ptr->is_dead) {
             break;
         }
 
-        process_monsters(player_ptr);
-        handle_stuff(player_ptr);
+        measure_turn_phase(TurnPhase::MONSTERS, [player_ptr] { process_monsters(player_ptr); });
+        measure_turn_phase(TurnPhase::HANDLE_STUFF, [player_ptr] { handle_stuff(player_ptr); });
 
         move_cursor_relative(player_ptr->y, player_ptr->x);
         if (fresh_after) {
-            term_fresh_force();
+            measure_turn_phase(TurnPhase::TERM_FRESH, term_fresh_force);
         }
 
         if (!player_ptr->playing || player_ptr->is_dead) {
             break;
         }
 
-        WorldTurnProcessor(player_ptr).process_world();
-        handle_stuff(player_ptr);
+        measure_turn_phase(TurnPhase::WORLD, [player_ptr] { WorldTurnProcessor(player_ptr).process_world(); });
+        measure_turn_phase(TurnPhase::HANDLE_STUFF, [player_ptr] { handle_stuff(player_ptr); });
 
         move_cursor_relative(player_ptr->y, player_ptr->x);
         if (fresh_after) {
-            term_fresh_force();
+            measure_turn_phase(TurnPhase::TERM_FRESH, term_fresh_force);
         }
 
         if (!player_ptr->playing || player_ptr->is_dead) {
@@ -238,6 +259,10 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
         if (wild_regen) {
             wild_regen--;
         }
+
+        if (turn_phase_observer) {
+            turn_phase_observer(TurnPhase::TURN, std::chrono::steady_clock::now() - turn_start);
+        }
     }
 
     if ((inside_quest(quest_num)) && questor_ptr->kind_flags.has_not(MonsterKindType::UNIQUE)) {
@@ -255,3 +280,12 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
 
     write_level = true;
 }
+
+/*!
+ * @brief ゲームターン内の処理の計測用フックを登録する
+ * @param observer 計測用フック (空の関数オブジェクトを渡すと解除)
+ */
+void set_turn_phase_observer(TurnPhaseObserver observer)
+{
+    turn_phase_observer = std::move(observer);
+}
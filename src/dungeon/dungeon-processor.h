@@ -1,4 +1,28 @@
 ﻿#pragma once
 
+#include <chrono>
+#include <functional>
+
+/*!
+ * @brief ゲームターン1回分の処理の区分
+ * @details TURN はループ1周 (ゲームターン1回) 全体の所要時間を表し、ターンの最後に通知される
+ */
+enum class TurnPhase {
+    PLAYER = 0, //!< process_player()
+    MONSTERS = 1, //!< process_monsters()
+    WORLD = 2, //!< WorldTurnProcessor::process_world()
+    HANDLE_STUFF = 3, //!< handle_stuff()
+    TERM_FRESH = 4, //!< term_fresh_force()
+    TURN = 5, //!< ゲームターン1回全体
+    MAX,
+};
+
+/*!
+ * @brief ゲームターン内の各処理が終わるたびに呼ばれる計測用フック
+ * @details 引数は処理の区分、所要時間
+ */
+using TurnPhaseObserver = std::function<void(TurnPhase, std::chrono::nanoseconds)>;
+
 class PlayerType;
 void process_dungeon(PlayerType *player_ptr, bool load_game);
+void set_turn_phase_observer(TurnPhaseObserver observer);
@@ -6,6 +6,7 @@
 
 #include "flavor/flavor-describer.h"
 #include "combat/shoot.h"
+#include "dungeon/quest.h"
 #include "flavor/flag-inscriptions-table.h"
 #include "flavor/flavor-util.h"
 #include "flavor/named-item-describer.h"
@@ -37,6 +38,7 @@
 #include "util/bit-flags-calculator.h"
 #include "util/string-processor.h"
 #include "window/display-sub-window-items.h"
+#include <array>
 
 static void describe_chest_trap(flavor_type *flavor_ptr)
 {
@@ -523,14 +525,13 @@ static void decide_item_feeling(flavor_type *flavor_ptr)
 }
 
 /*!
- * @brief オブジェクトの各表記を返すメイン関数 / Creates a description of the item "o_ptr", and stores it in "out_val".
+ * @brief オブジェクトの表記を組み立てる
  * @param player_ptr プレイヤーへの参照ポインタ
  * @param buf 表記を返すための文字列参照ポインタ
  * @param o_ptr 特性短縮表記を得たいオブジェクト構造体の参照ポインタ
  * @param mode 表記に関するオプション指定
- * @return 現在クエスト達成目的のアイテムならばTRUEを返す
  */
-void describe_flavor(PlayerType *player_ptr, char *buf, ObjectType *o_ptr, BIT_FLAGS mode)
+static void build_flavor_description(PlayerType *player_ptr, char *buf, ObjectType *o_ptr, BIT_FLAGS mode)
 {
     flavor_type tmp_flavor;
     flavor_type *flavor_ptr = initialize_flavor_type(&tmp_flavor, buf, o_ptr, mode);
@@ -571,3 +572,90 @@ void describe_flavor(PlayerType *player_ptr, char *buf, ObjectType *o_ptr, BIT_F
     display_item_fake_inscription(flavor_ptr);
     angband_strcpy(flavor_ptr->buf, flavor_ptr->tmp_val, MAX_NLEN);
 }
+
+namespace {
+
+/*!
+ * @brief 表記を覚えておく件数
+ */
+constexpr size_t DESCRIPTION_CACHE_SIZE = 512;
+
+/*!
+ * @brief 組み立てたアイテム表記1つ分
+ */
+struct description_cache_entry {
+    const ObjectType *o_ptr = nullptr; //!< 表記を組み立てたアイテムの場所
+    ObjectType item{}; //!< 表記を組み立てた時のアイテムの状態
+    BIT_FLAGS mode = 0; //!< 表記に関するオプション指定
+    uint32_t knowledge_epoch = 0; //!< 組み立てた時のアイテム知識の世代番号
+    QuestId quest_number{}; //!< 組み立てた時のクエスト
+    bool is_riding = false; //!< 組み立てた時に乗馬していたか
+    bool plain_descriptions = false; //!< 組み立てた時の plain_descriptions オプション
+    bool valid = false; //!< 記録済か
+    char description[MAX_NLEN]{}; //!< 組み立てた表記
+};
+
+std::array<description_cache_entry, DESCRIPTION_CACHE_SIZE> description_cache;
+uint32_t object_knowledge_epoch = 0; //!< アイテムの知識が変わるたびに進む世代番号
+
+/*!
+ * @brief 表記を使い回せるアイテムかを返す
+ * @details 矢弾やスパイクの威力、射撃武器の射撃回数、鍛冶師の名前はプレイヤーの状態で変わるため、毎回組み立てる
+ */
+bool can_cache_description(const ObjectType *o_ptr, BIT_FLAGS mode)
+{
+    if (o_ptr->is_smith()) {
+        return false;
+    }
+
+    return any_bits(mode, OD_DEBUG) || (!o_ptr->is_ammo() && (o_ptr->tval != ItemKindType::SPIKE) && (o_ptr->tval != ItemKindType::BOW));
+}
+
+}
+
+/*!
+ * @brief アイテムの知識が変わったことを知らせ、覚えていた表記を全て無効にする
+ * @details 鑑定・未判明アイテムの判明・使用済の記録など、同じアイテムでも表記が変わる時に呼ぶ
+ */
+void invalidate_object_descriptions()
+{
+    object_knowledge_epoch++;
+}
+
+/*!
+ * @brief オブジェクトの各表記を返すメイン関数 / Creates a description of the item "o_ptr", and stores it in "out_val".
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param buf 表記を返すための文字列参照ポインタ
+ * @param o_ptr 特性短縮表記を得たいオブジェクト構造体の参照ポインタ
+ * @param mode 表記に関するオプション指定
+ * @details
+ * 一覧の再描画のたびに同じアイテムの表記を組み立て直さないよう、アイテムの場所ごとに組み立てた表記を覚えておく。
+ * アイテムの状態・オプション指定・アイテム知識の世代番号などが全て同じ時だけ使い回す。
+ */
+void describe_flavor(PlayerType *player_ptr, char *buf, ObjectType *o_ptr, BIT_FLAGS mode)
+{
+    if (!can_cache_description(o_ptr, mode)) {
+        build_flavor_description(player_ptr, buf, o_ptr, mode);
+        return;
+    }
+
+    const auto address = reinterpret_cast<uintptr_t>(o_ptr);
+    auto &entry = description_cache[((address / alignof(ObjectType)) ^ mode) % DESCRIPTION_CACHE_SIZE];
+    const auto quest_number = player_ptr->current_floor_ptr->quest_number;
+    const auto is_riding = player_ptr->riding > 0;
+    if (entry.valid && (entry.o_ptr == o_ptr) && (entry.mode == mode) && (entry.knowledge_epoch == object_knowledge_epoch) && (entry.quest_number == quest_number) && (entry.is_riding == is_riding) && (entry.plain_descriptions == plain_descriptions) && entry.item.is_same_state(o_ptr)) {
+        angband_strcpy(buf, entry.description, MAX_NLEN);
+        return;
+    }
+
+    build_flavor_description(player_ptr, buf, o_ptr, mode);
+    entry.o_ptr = o_ptr;
+    entry.item = *o_ptr;
+    entry.mode = mode;
+    entry.knowledge_epoch = object_knowledge_epoch;
+    entry.quest_number = quest_number;
+    entry.is_riding = is_riding;
+    entry.plain_descriptions = plain_descriptions;
+    entry.valid = true;
+    angband_strcpy(entry.description, buf, MAX_NLEN);
+}
@@ -4,4 +4,5 @@
 
 class ObjectType;
 class PlayerType;
+void invalidate_object_descriptions();
 void describe_flavor(PlayerType *player_ptr, char *buf, ObjectType *o_ptr, BIT_FLAGS mode);
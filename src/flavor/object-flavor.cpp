@@ -12,6 +12,7 @@
 #include "flavor/object-flavor.h"
 #include "combat/shoot.h"
 #include "flavor/flag-inscriptions-table.h"
+#include "flavor/flavor-describer.h"
 #include "flavor/flavor-util.h"
 #include "flavor/object-flavor-types.h"
 #include "game-option/text-display-options.h"
@@ -245,6 +246,8 @@ void flavor_init(void)
 
         k_ref.easy_know = object_easy_know(k_ref.idx);
     }
+
+    invalidate_object_descriptions();
 }
 
 /*!
@@ -4,6 +4,7 @@
 #include "dungeon/quest-monster-placer.h"
 #include "floor/dungeon-tunnel-util.h"
 #include "floor/floor-allocation-types.h"
+#include "floor/floor-connectivity.h"
 #include "floor/floor-streams.h"
 #include "floor/geometry.h"
 #include "floor/object-allocator.h"
@@ -33,7 +34,6 @@
 static void reset_lite_area(floor_type *floor_ptr)
 {
     floor_ptr->lite_n = 0;
-    floor_ptr->mon_lite_n = 0;
     floor_ptr->redraw_n = 0;
     floor_ptr->view_n = 0;
 }
@@ -405,9 +405,13 @@ static void decide_grid_glowing(floor_type *floor_ptr, dun_data_type *dd_ptr, du
  * @details Note that "dun_body" adds about 4000 bytes of memory to the stack.
  * @param player_ptr プレイヤーへの参照ポインタ
  * @param why エラー原因メッセージを返す
+ * @param allow_disconnected 連結でないフロアも受け入れるならばTRUE
  * @return ダンジョン生成が全て無事に成功したらTRUEを返す。
+ * @details
+ * 連結性は永久地形の配置が出揃った時点 (外周の永久壁を置いた後) で判定する。
+ * 連結でない候補はプレイヤー・モンスター・アイテムを配置する前にやり直す。
  */
-bool cave_gen(PlayerType *player_ptr, concptr *why)
+bool cave_gen(PlayerType *player_ptr, concptr *why, bool allow_disconnected)
 {
     auto *floor_ptr = player_ptr->current_floor_ptr;
     reset_lite_area(floor_ptr);
@@ -439,6 +443,15 @@ bool cave_gen(PlayerType *player_ptr, concptr *why)
 
     make_aqua_streams(player_ptr, dd_ptr, d_ptr);
     make_perm_walls(player_ptr);
+    if (!floor_is_connected(floor_ptr)) {
+        if (!allow_disconnected) {
+            *dd_ptr->why = _("フロアが連結でない", "floor is not connected");
+            return false;
+        }
+
+        plog("cannot generate connected floor. giving up...");
+    }
+
     if (!check_place_necessary_objects(player_ptr, dd_ptr)) {
         return false;
     }
@@ -3,4 +3,4 @@
 #include "system/angband.h"
 
 class PlayerType;
-bool cave_gen(PlayerType *player_ptr, concptr *why);
+bool cave_gen(PlayerType *player_ptr, concptr *why, bool allow_disconnected);
@@ -411,6 +411,7 @@ void change_floor(PlayerType *player_ptr)
     panel_col_max = 0;
     player_ptr->ambush_flag = false;
     update_floor(player_ptr);
+    player_ptr->current_floor_ptr->terrain_epoch++;
     place_pet(player_ptr);
     forget_travel_flow(player_ptr->current_floor_ptr);
     update_unique_artifact(player_ptr->current_floor_ptr, new_floor_id);
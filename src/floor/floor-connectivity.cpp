@@ -0,0 +1,139 @@
+﻿/*!
+ * @brief フロアの連結性の判定 / Floor connectivity check
+ * @date 2026/10/19
+ * @details
+ * プレイヤーが通れない永久地形だけを壁とみなし、フロア全体が1つにつながっているかを
+ * 素集合データ構造 (Union-Find) で調べる。
+ * マスを1行ずつ走査し、走査済みの隣接マス (左・左上・上・右上) と同じ集合にまとめるので、
+ * 探索用のスタックを用いずにフロア全体を1回走査するだけで連結成分の数が分かる。
+ */
+
+#include "floor/floor-connectivity.h"
+#include "grid/feature.h"
+#include "system/floor-type-definition.h"
+#include "system/grid-type-definition.h"
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/*!
+ * @brief マスの連結成分を管理する素集合データ構造
+ */
+class GridDisjointSet {
+public:
+    /*!
+     * @brief 全てのマスを別々の集合として初期化する
+     * @param size マスの数
+     */
+    void reset(int size)
+    {
+        this->parents.resize(size);
+        std::iota(this->parents.begin(), this->parents.end(), 0);
+    }
+
+    /*!
+     * @brief マスが属する集合の代表を求める
+     * @param idx マスの通し番号
+     * @return 集合の代表のマスの通し番号
+     * @details 辿った経路は1つおきに代表側へ付け替えて短くする
+     */
+    int find(int idx)
+    {
+        while (this->parents[idx] != idx) {
+            this->parents[idx] = this->parents[this->parents[idx]];
+            idx = this->parents[idx];
+        }
+
+        return idx;
+    }
+
+    /*!
+     * @brief 2つのマスが属する集合を1つにまとめる
+     * @param idx1 マス1の通し番号
+     * @param idx2 マス2の通し番号
+     * @return 別々の集合をまとめたならばTRUE、既に同じ集合だったならばFALSE
+     */
+    bool unite(int idx1, int idx2)
+    {
+        auto root1 = this->find(idx1);
+        auto root2 = this->find(idx2);
+        if (root1 == root2) {
+            return false;
+        }
+
+        if (root1 < root2) {
+            std::swap(root1, root2);
+        }
+
+        this->parents[root1] = root2;
+        return true;
+    }
+
+private:
+    std::vector<int> parents; //!< マスごとの親のマスの通し番号
+};
+
+/*!
+ * @brief マスがプレイヤーの通れない永久地形かどうかを返す
+ * @param g_ref マスへの参照
+ * @return 通れない永久地形ならばTRUE
+ */
+bool is_permanent_blocker(const grid_type &g_ref)
+{
+    const auto &flags = f_info[g_ref.feat].flags;
+    return flags.has(FloorFeatureType::PERMANENT) && flags.has_not(FloorFeatureType::MOVE);
+}
+
+}
+
+/*!
+ * @brief 現在のフロアが連結かどうかを返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return 通れるマスが1つ以上あり、全て8近傍でつながっているならばTRUE
+ * @details 各マスの8近傍は互いに移動可能とし、通れない永久地形のみを壁とみなす。
+ */
+bool floor_is_connected(const floor_type *floor_ptr)
+{
+    static GridDisjointSet grids;
+    static std::vector<bool> is_open;
+
+    const int h = floor_ptr->height;
+    const int w = floor_ptr->width;
+    grids.reset(h * w);
+    is_open.assign(h * w, false);
+
+    // 走査済みの隣接マス (左・左上・上・右上)
+    // clang-format off
+    static const int DY[4] = {  0, -1, -1, -1 };
+    static const int DX[4] = { -1, -1,  0,  1 };
+    // clang-format on
+
+    auto n_component = 0; // 連結成分数
+    for (auto y = 0; y < h; y++) {
+        for (auto x = 0; x < w; x++) {
+            if (is_permanent_blocker(floor_ptr->grid_array[y][x])) {
+                continue;
+            }
+
+            const auto idx = w * y + x;
+            is_open[idx] = true;
+            n_component++;
+            for (auto i = 0; i < 4; i++) {
+                const auto y_nxt = y + DY[i];
+                const auto x_nxt = x + DX[i];
+                if ((y_nxt < 0) || (x_nxt < 0) || (w <= x_nxt)) {
+                    continue;
+                }
+
+                const auto nxt = w * y_nxt + x_nxt;
+                if (is_open[nxt] && grids.unite(idx, nxt)) {
+                    n_component--;
+                }
+            }
+        }
+    }
+
+    return n_component == 1;
+}
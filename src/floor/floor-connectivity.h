@@ -0,0 +1,4 @@
+﻿#pragma once
+
+struct floor_type;
+bool floor_is_connected(const floor_type *floor_ptr);
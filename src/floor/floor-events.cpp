@@ -357,6 +357,7 @@ void forget_lite(floor_type *floor_ptr)
     }
 
     floor_ptr->lite_n = 0;
+    floor_ptr->sight_epoch++;
 }
 
 /*
@@ -377,4 +378,5 @@ void forget_view(floor_type *floor_ptr)
     }
 
     floor_ptr->view_n = 0;
+    floor_ptr->sight_epoch++;
 }
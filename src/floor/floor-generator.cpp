@@ -39,6 +39,7 @@
 #include "monster/monster-update.h"
 #include "monster/monster-util.h"
 #include "player/player-status.h"
+#include "system/artifact-type-definition.h"
 #include "system/building-type-definition.h"
 #include "system/floor-type-definition.h"
 #include "system/grid-type-definition.h"
@@ -52,8 +53,9 @@
 #include "wizard/wizard-messages.h"
 #include "world/world.h"
 #include <algorithm>
-#include <array>
-#include <stack>
+#include <map>
+#include <string>
+#include <vector>
 
 /*!
  * @brief 闘技場用のアリーナ地形を作成する / Builds the on_defeat_arena_monster after it is entered -KMW-
@@ -282,9 +284,10 @@ static void generate_fixed_floor(PlayerType *player_ptr)
  * @brief ダンジョン時のランダムフロア生成 / Make a real level
  * @param player_ptr プレイヤーへの参照ポインタ
  * @param concptr
+ * @param allow_disconnected 連結でないフロアも受け入れるならばTRUE
  * @return フロアの生成に成功したらTRUE
  */
-static bool level_gen(PlayerType *player_ptr, concptr *why)
+static bool level_gen(PlayerType *player_ptr, concptr *why, bool allow_disconnected)
 {
     auto *floor_ptr = player_ptr->current_floor_ptr;
     DUNGEON_IDX d_idx = floor_ptr->dungeon_idx;
@@ -324,7 +327,7 @@ static bool level_gen(PlayerType *player_ptr, concptr *why)
         panel_col_min = floor_ptr->width;
     }
 
-    return cave_gen(player_ptr, why);
+    return cave_gen(player_ptr, why, allow_disconnected);
 }
 
 /*!
@@ -357,6 +360,7 @@ void clear_cave(PlayerType *player_ptr)
     std::fill_n(floor_ptr->o_list.begin(), floor_ptr->o_max, ObjectType{});
     floor_ptr->o_max = 1;
     floor_ptr->o_cnt = 0;
+    floor_ptr->o_list_epoch++;
 
     for (auto &[r_idx, r_ref] : r_info) {
         r_ref.cur_num = 0;
@@ -365,6 +369,7 @@ void clear_cave(PlayerType *player_ptr)
     std::fill_n(floor_ptr->m_list.begin(), floor_ptr->m_max, monster_type{});
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
+    floor_ptr->m_list_epoch++;
     for (int i = 0; i < MAX_MTIMED; i++) {
         floor_ptr->mproc_max[i] = 0;
     }
@@ -390,106 +395,47 @@ void clear_cave(PlayerType *player_ptr)
     floor_ptr->object_level = floor_ptr->base_level;
 }
 
-typedef bool (*IsWallFunc)(const floor_type *, int, int);
+/*!
+ * @brief フロア生成の集計値
+ */
+struct floor_generation_stats {
+    uint64_t floors = 0; //!< 生成したフロアの数
+    uint64_t candidates = 0; //!< 作った生成候補の数
+    std::map<std::string, uint64_t> retry_reasons; //!< 生成やり直しの理由ごとの回数
+};
 
-// (y,x) がプレイヤーが通れない永久地形かどうかを返す。
-static bool is_permanent_blocker(const floor_type *const floor_ptr, const int y, const int x)
-{
-    const FEAT_IDX feat = floor_ptr->grid_array[y][x].feat;
-    const auto &flags = f_info[feat].flags;
-    return flags.has(FloorFeatureType::PERMANENT) && flags.has_not(FloorFeatureType::MOVE);
-}
+static floor_generation_stats generation_stats;
 
-static void floor_is_connected_dfs(const floor_type *const floor_ptr, const IsWallFunc is_wall, const int y_start, const int x_start, bool *const visited)
+/*!
+ * @brief フロア生成候補ごとの乱数シードを求める
+ * @param level_seed フロア全体のシード
+ * @param candidate 候補番号 (生成やり直しの回数)
+ * @return 候補用の乱数シード
+ * @details
+ * 候補の乱数系列はフロアのシードと候補番号だけで決まる。
+ * そのため同じシードからは、何回目の候補で生成に成功しても同じフロアが得られる。
+ */
+static uint32_t derive_candidate_seed(uint32_t level_seed, int candidate)
 {
-    // clang-format off
-    static const int DY[8] = { -1, -1, -1,  0, 0,  1, 1, 1 };
-    static const int DX[8] = { -1,  0,  1, -1, 1, -1, 0, 1 };
-    // clang-format on
-
-    const int h = floor_ptr->height;
-    const int w = floor_ptr->width;
-    const int start = w * y_start + x_start;
-
-    // 深さ優先探索用のスタック。
-    // 最大フロアサイズが h=66, w=198 なので、スタックオーバーフロー防止のため再帰は使わない。
-    std::stack<int> stk;
-
-    stk.emplace(start);
-    visited[start] = true;
-
-    while (!stk.empty()) {
-        const int cur = stk.top();
-        stk.pop();
-        const int y = cur / w;
-        const int x = cur % w;
-
-        for (int i = 0; i < 8; ++i) {
-            const int y_nxt = y + DY[i];
-            const int x_nxt = x + DX[i];
-            if (y_nxt < 0 || h <= y_nxt || x_nxt < 0 || w <= x_nxt) {
-                continue;
-            }
-            const int nxt = w * y_nxt + x_nxt;
-            if (visited[nxt]) {
-                continue;
-            }
-            if (is_wall(floor_ptr, y_nxt, x_nxt)) {
-                continue;
-            }
-
-            stk.emplace(nxt);
-            visited[nxt] = true;
-        }
-    }
-}
-
-// 現在のフロアが連結かどうかを返す。
-// 各セルの8近傍は互いに移動可能とし、is_wall が真を返すセルのみを壁とみなす。
-//
-// 連結成分数が 0 の場合、偽を返す。
-static bool floor_is_connected(const floor_type *const floor_ptr, const IsWallFunc is_wall)
-{
-    static std::array<bool, MAX_HGT * MAX_WID> visited;
-
-    const int h = floor_ptr->height;
-    const int w = floor_ptr->width;
-
-    std::fill(begin(visited), end(visited), false);
-
-    int n_component = 0; // 連結成分数
-
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            const int idx = w * y + x;
-            if (visited[idx]) {
-                continue;
-            }
-            if (is_wall(floor_ptr, y, x)) {
-                continue;
-            }
-
-            if (++n_component >= 2) {
-                break;
-            }
-            floor_is_connected_dfs(floor_ptr, is_wall, y, x, visited.data());
-        }
-    }
-
-    return n_component == 1;
+    uint32_t seed = level_seed + static_cast<uint32_t>(candidate) * 0x9E3779B9U;
+    seed = (seed ^ (seed >> 16)) * 0x85EBCA6BU;
+    seed = (seed ^ (seed >> 13)) * 0xC2B2AE35U;
+    return seed ^ (seed >> 16);
 }
 
 /*!
- * ダンジョンのランダムフロアを生成する / Generates a random dungeon level -RAK-
- * @parama player_ptr プレイヤーへの参照ポインタ
- * @note Hack -- regenerate any "overflow" levels
+ * @brief 条件を満たすフロアが得られるまで生成候補を順に作る
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param level_seed フロア全体のシード
+ * @param verbose 生成やり直しの理由をメッセージ表示するならばTRUE
+ * @return 生成した候補の数
+ * @details 最初に条件を満たした候補 (番号最小の候補) を採用する。
  */
-void generate_floor(PlayerType *player_ptr)
+static int generate_floor_candidates(PlayerType *player_ptr, uint32_t level_seed, bool verbose)
 {
     auto *floor_ptr = player_ptr->current_floor_ptr;
-    floor_ptr->dungeon_idx = player_ptr->dungeon_idx;
-    set_floor_and_wall(floor_ptr->dungeon_idx);
     for (int num = 0; true; num++) {
+        w_ptr->rng.set_state(derive_candidate_seed(level_seed, num));
         bool okay = true;
         concptr why = nullptr;
         clear_cave(player_ptr);
@@ -507,7 +453,11 @@ void generate_floor(PlayerType *player_ptr)
                 wilderness_gen(player_ptr);
             }
         } else {
-            okay = level_gen(player_ptr, &why);
+            // ダンジョン内フロアが連結でない(永久壁で区切られた孤立部屋がある)場合、
+            // 狂戦士でのプレイに支障をきたしうるので再生成する。
+            // 地上、荒野マップ、クエストでは連結性判定は行わない。
+            // 一定回数試しても連結にならないなら諦める。
+            okay = level_gen(player_ptr, &why, num >= 1000);
         }
 
         if (floor_ptr->o_max >= w_ptr->max_o_idx) {
@@ -518,34 +468,126 @@ void generate_floor(PlayerType *player_ptr)
             okay = false;
         }
 
-        // ダンジョン内フロアが連結でない(永久壁で区切られた孤立部屋がある)場合、
-        // 狂戦士でのプレイに支障をきたしうるので再生成する。
-        // 地上、荒野マップ、クエストでは連結性判定は行わない。
-        // TODO: 本来はダンジョン生成アルゴリズム自身で連結性を保証するのが理想ではある。
-        const bool check_conn = okay && floor_ptr->dun_level > 0 && !inside_quest(floor_ptr->quest_number);
-        if (check_conn && !floor_is_connected(floor_ptr, is_permanent_blocker)) {
-            // 一定回数試しても連結にならないなら諦める。
-            if (num >= 1000) {
-                plog("cannot generate connected floor. giving up...");
-            } else {
-                why = _("フロアが連結でない", "floor is not connected");
-                okay = false;
-            }
-        }
-
+        generation_stats.candidates++;
         if (okay) {
-            break;
+            generation_stats.floors++;
+            return num + 1;
         }
 
-        if (why) {
+        generation_stats.retry_reasons[why ? why : "(unknown)"]++;
+        if (why && verbose) {
             msg_format(_("生成やり直し(%s)", "Generation restarted (%s)"), why);
         }
 
         wipe_o_list(floor_ptr);
         wipe_monsters_list(player_ptr);
     }
+}
 
+/*!
+ * ダンジョンのランダムフロアを生成する / Generates a random dungeon level -RAK-
+ * @parama player_ptr プレイヤーへの参照ポインタ
+ * @note Hack -- regenerate any "overflow" levels
+ * @details
+ * フロア生成はゲーム進行用の乱数系列から1つだけシードを引き、各生成候補はそこから導いた独立な系列で行う。
+ * 生成後はゲーム進行用の系列へ戻す。
+ */
+void generate_floor(PlayerType *player_ptr)
+{
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    floor_ptr->dungeon_idx = player_ptr->dungeon_idx;
+    set_floor_and_wall(floor_ptr->dungeon_idx);
+    const auto level_seed = w_ptr->rng();
+    const auto rng_backup = w_ptr->rng.get_state();
+    (void)generate_floor_candidates(player_ptr, level_seed, true);
+    w_ptr->rng.set_state(rng_backup);
     glow_deep_lava_and_bldg(player_ptr);
     player_ptr->enter_dungeon = false;
     wipe_generate_random_floor_flags(floor_ptr);
 }
+
+/*!
+ * @brief シードを指定してダンジョンのランダムフロアを独立したフロアへ生成する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param floor_ptr 生成先のフロア (grid_array, o_list, m_list, mproc_list は確保済みであること)
+ * @param dungeon_idx ダンジョンID
+ * @param dun_level 階層
+ * @param seed フロアのシード
+ * @return 生成した候補の数 (1ならやり直しなし)
+ * @details
+ * 同じ (dungeon_idx, dun_level, seed) からは常に同じフロアが得られる。
+ * 生成中はプレイヤーの現在フロア等を一時的に差し替えるが、
+ * プレイヤーの位置・現在フロア・乱数系列・モンスター/アーティファクトの生成数は呼び出し前の状態に戻す。
+ * プロファイリングや回帰確認のためのものであり、ゲーム進行中のフロア生成には generate_floor() を用いること。
+ */
+int generate_floor_with_seed(PlayerType *player_ptr, floor_type *floor_ptr, DUNGEON_IDX dungeon_idx, DEPTH dun_level, uint32_t seed)
+{
+    auto *floor_backup = player_ptr->current_floor_ptr;
+    const auto dungeon_idx_backup = player_ptr->dungeon_idx;
+    const auto y_backup = player_ptr->y;
+    const auto x_backup = player_ptr->x;
+    const auto phase_out_backup = player_ptr->phase_out;
+    const auto rng_backup = w_ptr->rng.get_state();
+    std::vector<MONSTER_NUMBER> r_cur_num_backup;
+    for (const auto &[r_idx, r_ref] : r_info) {
+        r_cur_num_backup.push_back(r_ref.cur_num);
+    }
+
+    std::vector<byte> a_cur_num_backup;
+    for (const auto &a_ref : a_info) {
+        a_cur_num_backup.push_back(a_ref.cur_num);
+    }
+
+    floor_ptr->dungeon_idx = dungeon_idx;
+    floor_ptr->dun_level = dun_level;
+    floor_ptr->quest_number = QuestId::NONE;
+    floor_ptr->inside_arena = false;
+    player_ptr->current_floor_ptr = floor_ptr;
+    player_ptr->dungeon_idx = dungeon_idx;
+    player_ptr->phase_out = false;
+    set_floor_and_wall(dungeon_idx);
+    const auto candidates = generate_floor_candidates(player_ptr, seed, false);
+    wipe_generate_random_floor_flags(floor_ptr);
+
+    player_ptr->current_floor_ptr = floor_backup;
+    player_ptr->dungeon_idx = dungeon_idx_backup;
+    player_ptr->y = y_backup;
+    player_ptr->x = x_backup;
+    player_ptr->phase_out = phase_out_backup;
+    w_ptr->rng.set_state(rng_backup);
+    set_floor_and_wall(floor_backup->dungeon_idx);
+    auto r_cur_num_it = r_cur_num_backup.begin();
+    for (auto &[r_idx, r_ref] : r_info) {
+        r_ref.cur_num = *r_cur_num_it++;
+    }
+
+    auto a_cur_num_it = a_cur_num_backup.begin();
+    for (auto &a_ref : a_info) {
+        a_ref.cur_num = *a_cur_num_it++;
+    }
+
+    return candidates;
+}
+
+/*!
+ * @brief フロア生成の候補数と、生成やり直しの理由ごとの回数を書き出す
+ * @param fp 出力先
+ */
+void dump_floor_generation_stats(FILE *fp)
+{
+    const auto retries = generation_stats.candidates - generation_stats.floors;
+    const auto average = generation_stats.floors ? static_cast<double>(generation_stats.candidates) / generation_stats.floors : 0.0;
+    fprintf(fp, "Floors: %llu, Candidates: %llu, Retries: %llu (%.2f candidates/floor)\n", static_cast<unsigned long long>(generation_stats.floors),
+        static_cast<unsigned long long>(generation_stats.candidates), static_cast<unsigned long long>(retries), average);
+    for (const auto &[why, count] : generation_stats.retry_reasons) {
+        fprintf(fp, "%12llu  %s\n", static_cast<unsigned long long>(count), why.data());
+    }
+}
+
+/*!
+ * @brief フロア生成の集計値を消去する
+ */
+void reset_floor_generation_stats()
+{
+    generation_stats = {};
+}
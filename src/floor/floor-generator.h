@@ -1,7 +1,13 @@
 ﻿#pragma once
 
+#include "system/angband.h"
+#include <cstdio>
+
 struct floor_type;
 class PlayerType;
 void wipe_generate_random_floor_flags(floor_type *floor_ptr);
 void clear_cave(PlayerType *player_ptr);
 void generate_floor(PlayerType *player_ptr);
+int generate_floor_with_seed(PlayerType *player_ptr, floor_type *floor_ptr, DUNGEON_IDX dungeon_idx, DEPTH dun_level, uint32_t seed);
+void dump_floor_generation_stats(FILE *fp);
+void reset_floor_generation_stats();
@@ -208,6 +208,8 @@ void delete_all_items_from_floor(PlayerType *player_ptr, POSITION y, POSITION x)
         floor_ptr->o_cnt--;
     }
 
+    floor_ptr->o_list_epoch++;
+
     g_ptr->o_idx_list.clear();
     lite_spot(player_ptr, y, x);
 }
@@ -281,6 +283,7 @@ void delete_object_idx(PlayerType *player_ptr, OBJECT_IDX o_idx)
 
     j_ptr->wipe();
     floor_ptr->o_cnt--;
+    floor_ptr->o_list_epoch++;
 
     set_bits(player_ptr->window_flags, PW_FLOOR_ITEM_LIST);
 }
@@ -0,0 +1,147 @@
+﻿/*!
+ * @brief 2グリッド間の判定結果のキャッシュ / Cache of results between two grids
+ * @date 2026/10/19
+ * @details
+ * los() と projectable() は地形しか参照しないため、同じ組の判定は地形が変わるまで同じ結果になる。
+ * モンスターが多いフロアでは同じ組を1ゲームターンに何度も判定するので、結果を覚えて使い回す。
+ */
+
+#include "floor/grid-pair-cache.h"
+#include "system/floor-type-definition.h"
+#include "world/world.h"
+
+namespace {
+
+/*!
+ * @brief 始点と終点の座標を1つの値に詰める
+ * @details フロアの大きさは 256 x 256 未満なので各座標は8ビットに収まる
+ */
+uint32_t make_grid_pair_key(POSITION y1, POSITION x1, POSITION y2, POSITION x2)
+{
+    return (static_cast<uint32_t>(y1 & 0xFF) << 24) | (static_cast<uint32_t>(x1 & 0xFF) << 16) | (static_cast<uint32_t>(y2 & 0xFF) << 8) | static_cast<uint32_t>(x2 & 0xFF);
+}
+
+/*!
+ * @brief キャッシュを使える状況かを返す
+ * @details フロア生成中は地形を直接書き換えるため、世代番号で無効にできない
+ */
+bool can_use_grid_pair_cache()
+{
+    return w_ptr->character_dungeon;
+}
+
+}
+
+/*!
+ * @brief 判定結果をキャッシュから探す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y1 始点のy座標
+ * @param x1 始点のx座標
+ * @param y2 終点のy座標
+ * @param x2 終点のx座標
+ * @param range 判定に使った射程 (射程によらない判定では0)
+ * @return 記録されていればその結果、なければ std::nullopt
+ */
+std::optional<bool> GridPairCache::find(const floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2, int range)
+{
+    if (!can_use_grid_pair_cache()) {
+        this->bypasses++;
+        return std::nullopt;
+    }
+
+    const auto key = make_grid_pair_key(y1, x1, y2, x2);
+    const auto &entry = this->entries[(key * 2654435761U) >> 20];
+    if (entry.valid && (entry.key == key) && (entry.terrain_epoch == floor_ptr->terrain_epoch) && (entry.range == range)) {
+        this->hits++;
+        return entry.result;
+    }
+
+    this->misses++;
+    return std::nullopt;
+}
+
+/*!
+ * @brief 判定結果をキャッシュに記録する
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y1 始点のy座標
+ * @param x1 始点のx座標
+ * @param y2 終点のy座標
+ * @param x2 終点のx座標
+ * @param result 判定結果
+ * @param range 判定に使った射程 (射程によらない判定では0)
+ */
+void GridPairCache::store(const floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2, bool result, int range)
+{
+    if (!can_use_grid_pair_cache()) {
+        return;
+    }
+
+    const auto key = make_grid_pair_key(y1, x1, y2, x2);
+    auto &entry = this->entries[(key * 2654435761U) >> 20];
+    entry.key = key;
+    entry.terrain_epoch = floor_ptr->terrain_epoch;
+    entry.range = static_cast<int16_t>(range);
+    entry.valid = true;
+    entry.result = result;
+}
+
+/*!
+ * @brief ヒット数・ミス数を消去する
+ */
+void GridPairCache::reset_stats()
+{
+    this->hits = 0;
+    this->misses = 0;
+    this->bypasses = 0;
+}
+
+/*!
+ * @brief ヒット数・ミス数を書き出す
+ * @param fp 出力先
+ * @param name キャッシュの名前
+ */
+void GridPairCache::dump_stats(FILE *fp, concptr name) const
+{
+    const auto lookups = this->hits + this->misses;
+    const auto hit_rate = lookups ? 100.0 * this->hits / lookups : 0.0;
+    fprintf(fp, "%-12s %12llu %12llu %12llu %8.2f%%\n", name, static_cast<unsigned long long>(this->hits), static_cast<unsigned long long>(this->misses),
+        static_cast<unsigned long long>(this->bypasses), hit_rate);
+}
+
+/*!
+ * @brief los() の判定結果のキャッシュを返す
+ */
+GridPairCache &get_los_cache()
+{
+    static GridPairCache cache{};
+    return cache;
+}
+
+/*!
+ * @brief projectable() の判定結果のキャッシュを返す
+ */
+GridPairCache &get_projectable_cache()
+{
+    static GridPairCache cache{};
+    return cache;
+}
+
+/*!
+ * @brief 視線・射線キャッシュのヒット数・ミス数を書き出す
+ * @param fp 出力先
+ */
+void dump_grid_pair_cache_stats(FILE *fp)
+{
+    fprintf(fp, "%-12s %12s %12s %12s %9s\n", "Cache", "Hits", "Misses", "Bypasses", "Hit rate");
+    get_los_cache().dump_stats(fp, "los");
+    get_projectable_cache().dump_stats(fp, "projectable");
+}
+
+/*!
+ * @brief 視線・射線キャッシュのヒット数・ミス数を消去する
+ */
+void reset_grid_pair_cache_stats()
+{
+    get_los_cache().reset_stats();
+    get_projectable_cache().reset_stats();
+}
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include <array>
+#include <cstdio>
+#include <optional>
+
+struct floor_type;
+
+/*!
+ * @brief 2つのグリッド間の判定結果 (視線・射線) を覚えておくキャッシュ
+ * @details
+ * 判定結果は地形だけで決まるため、フロアの地形の世代番号 (terrain_epoch) が
+ * 変わった時点で全ての結果を無効とする。
+ * 容量は固定で、同じ位置に割り当てられた組は後から記録したもので上書きする。
+ */
+class GridPairCache {
+public:
+    GridPairCache() = default;
+    std::optional<bool> find(const floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2, int range = 0);
+    void store(const floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2, bool result, int range = 0);
+    void reset_stats();
+    void dump_stats(FILE *fp, concptr name) const;
+
+private:
+    /*!
+     * @brief 判定結果1つ分
+     */
+    struct entry {
+        uint32_t key = 0; //!< 始点と終点の座標を詰めた値
+        uint32_t terrain_epoch = 0; //!< 記録した時の地形の世代番号
+        int16_t range = 0; //!< 記録した時の射程
+        bool valid = false; //!< 記録済か
+        bool result = false; //!< 判定結果
+    };
+
+    static constexpr size_t ENTRY_NUM = 4096;
+    std::array<entry, ENTRY_NUM> entries{};
+    uint64_t hits = 0; //!< キャッシュにあった回数
+    uint64_t misses = 0; //!< キャッシュになかった回数
+    uint64_t bypasses = 0; //!< フロア生成中などでキャッシュを使わなかった回数
+};
+
+GridPairCache &get_los_cache();
+GridPairCache &get_projectable_cache();
+void dump_grid_pair_cache_stats(FILE *fp);
+void reset_grid_pair_cache_stats();
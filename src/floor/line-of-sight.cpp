@@ -1,63 +1,26 @@
 ﻿#include "floor/line-of-sight.h"
 #include "floor/cave.h"
+#include "floor/grid-pair-cache.h"
 #include "system/floor-type-definition.h"
 #include "system/player-type-definition.h"
 
 /*!
- * @brief LOS(Line Of Sight / 視線が通っているか)の判定を行う。
- * @param player_ptr プレイヤーへの参照ポインタ
+ * @brief 始点から終点まで視線をたどり、遮る地形がないかを調べる
+ * @param floor_ptr フロアへの参照ポインタ
  * @param y1 始点のy座標
  * @param x1 始点のx座標
  * @param y2 終点のy座標
  * @param x2 終点のx座標
  * @return LOSが通っているならTRUEを返す。
- * @details
- * A simple, fast, integer-based line-of-sight algorithm.  By Joseph Hall,\n
- * 4116 Brewster Drive, Raleigh NC 27606.  Email to jnh@ecemwl.ncsu.edu.\n
- *\n
- * Returns TRUE if a line of sight can be traced from (x1,y1) to (x2,y2).\n
- *\n
- * The LOS begins at the center of the tile (x1,y1) and ends at the center of\n
- * the tile (x2,y2).  If los() is to return TRUE, all of the tiles this line\n
- * passes through must be floor tiles, except for (x1,y1) and (x2,y2).\n
- *\n
- * We assume that the "mathematical corner" of a non-floor tile does not\n
- * block line of sight.\n
- *\n
- * Because this function uses (short) ints for all calculations, overflow may\n
- * occur if dx and dy exceed 90.\n
- *\n
- * Once all the degenerate cases are eliminated, the values "qx", "qy", and\n
- * "m" are multiplied by a scale factor "f1 = abs(dx * dy * 2)", so that\n
- * we can use integer arithmetic.\n
- *\n
- * We travel from start to finish along the longer axis, starting at the border\n
- * between the first and second tiles, where the y offset = .5 * slope, taking\n
- * into account the scale factor.  See below.\n
- *\n
- * Also note that this function and the "move towards target" code do NOT\n
- * share the same properties.  Thus, you can see someone, target them, and\n
- * then fire a bolt at them, but the bolt may hit a wall, not them.  However\n,
- * by clever choice of target locations, you can sometimes throw a "curve".\n
- *\n
- * Note that "line of sight" is not "reflexive" in all cases.\n
- *\n
- * Use the "projectable()" routine to test "spell/missile line of sight".\n
- *\n
- * Use the "update_view()" function to determine player line-of-sight.\n
  */
-bool los(PlayerType *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
+static bool trace_los(floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
 {
     POSITION dy = y2 - y1;
     POSITION dx = x2 - x1;
     POSITION ay = std::abs(dy);
     POSITION ax = std::abs(dx);
-    if ((ax < 2) && (ay < 2)) {
-        return true;
-    }
 
     /* Directly South/North */
-    auto *floor_ptr = player_ptr->current_floor_ptr;
     POSITION tx, ty;
     if (!dx) {
         /* South -- check for walls */
@@ -211,3 +174,65 @@ bool los(PlayerType *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION
 
     return true;
 }
+
+/*!
+ * @brief LOS(Line Of Sight / 視線が通っているか)の判定を行う。
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param y1 始点のy座標
+ * @param x1 始点のx座標
+ * @param y2 終点のy座標
+ * @param x2 終点のx座標
+ * @return LOSが通っているならTRUEを返す。
+ * @details
+ * A simple, fast, integer-based line-of-sight algorithm.  By Joseph Hall,\n
+ * 4116 Brewster Drive, Raleigh NC 27606.  Email to jnh@ecemwl.ncsu.edu.\n
+ *\n
+ * Returns TRUE if a line of sight can be traced from (x1,y1) to (x2,y2).\n
+ *\n
+ * The LOS begins at the center of the tile (x1,y1) and ends at the center of\n
+ * the tile (x2,y2).  If los() is to return TRUE, all of the tiles this line\n
+ * passes through must be floor tiles, except for (x1,y1) and (x2,y2).\n
+ *\n
+ * We assume that the "mathematical corner" of a non-floor tile does not\n
+ * block line of sight.\n
+ *\n
+ * Because this function uses (short) ints for all calculations, overflow may\n
+ * occur if dx and dy exceed 90.\n
+ *\n
+ * Once all the degenerate cases are eliminated, the values "qx", "qy", and\n
+ * "m" are multiplied by a scale factor "f1 = abs(dx * dy * 2)", so that\n
+ * we can use integer arithmetic.\n
+ *\n
+ * We travel from start to finish along the longer axis, starting at the border\n
+ * between the first and second tiles, where the y offset = .5 * slope, taking\n
+ * into account the scale factor.  See below.\n
+ *\n
+ * Also note that this function and the "move towards target" code do NOT\n
+ * share the same properties.  Thus, you can see someone, target them, and\n
+ * then fire a bolt at them, but the bolt may hit a wall, not them.  However\n,
+ * by clever choice of target locations, you can sometimes throw a "curve".\n
+ *\n
+ * Note that "line of sight" is not "reflexive" in all cases.\n
+ *\n
+ * Use the "projectable()" routine to test "spell/missile line of sight".\n
+ *\n
+ * Use the "update_view()" function to determine player line-of-sight.\n
+ *\n
+ * 結果は地形が変わるまで同じなので、キャッシュに記録して使い回す。
+ */
+bool los(PlayerType *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
+{
+    if ((std::abs(y2 - y1) < 2) && (std::abs(x2 - x1) < 2)) {
+        return true;
+    }
+
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    auto &cache = get_los_cache();
+    if (const auto cached = cache.find(floor_ptr, y1, x1, y2, x2); cached) {
+        return *cached;
+    }
+
+    const auto result = trace_los(floor_ptr, y1, x1, y2, x2);
+    cache.store(floor_ptr, y1, x1, y2, x2, result);
+    return result;
+}
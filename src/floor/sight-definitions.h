@@ -7,14 +7,6 @@
  */
 #define LITE_MAX 600
 
-/*!
- * @brief モンスター用光源処理配列サイズ / Maximum size of the "mon_lite" array (see ">grid.c")
- * @details Note that the "view radius" will NEVER exceed 20, monster illumination
- * flags are dependent on CAVE_VIEW, and even if the "view" was octagonal,
- * we would never require more than 1520 entries in the array.
- */
-#define MON_LITE_MAX 1536
-
 /*!
  * @brief 視界処理配列サイズ / Maximum size of the "view" array
  * @details Note that the "view radius" will NEVER exceed 20, and even if the "view"
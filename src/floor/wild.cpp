@@ -47,8 +47,10 @@
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
 #include "world/world.h"
+#include <list>
 
 #define MAX_FEAT_IN_TERRAIN 18
+#define WILDERNESS_AREA_CACHE_SIZE 18
 
 std::vector<std::vector<wilderness_type>> wilderness;
 bool generate_encounter;
@@ -223,14 +225,110 @@ static void plasma_recursive(floor_type *floor_ptr, POSITION x1, POSITION y1, PO
 /* The default table in terrain level generation. */
 static int16_t terrain_table[MAX_WILDERNESS][MAX_FEAT_IN_TERRAIN];
 
+/*!
+ * @brief 生成済みの荒野地形1区画分 / A generated wilderness terrain area
+ */
+struct wilderness_area_cache_type {
+    POSITION wy; /*!< 広域Y座標 */
+    POSITION wx; /*!< 広域X座標 */
+    uint32_t seed; /*!< 生成に用いた乱数シード */
+    std::vector<FEAT_IDX> feats; /*!< MAX_HGT * MAX_WID の地形ID */
+};
+
+/*!
+ * @brief 直近に生成した荒野地形のキャッシュ (先頭ほど新しい)
+ * @details
+ * 荒野の地形は固定シードから決定的に生成されるため、同じ座標とシードなら結果を再利用できる。
+ * 1歩移動すると周囲3x3区画のうち6区画が重複するので、2回分の周囲区画を保持する。
+ */
+static std::list<wilderness_area_cache_type> wilderness_area_cache;
+
+/*!
+ * @brief 荒野地形キャッシュを検索する
+ * @param wy 広域Y座標
+ * @param wx 広域X座標
+ * @param seed 乱数の固定シード
+ * @return 見つかった地形データへのポインタ。なければnullptr
+ */
+static const std::vector<FEAT_IDX> *find_wilderness_area_cache(POSITION wy, POSITION wx, uint32_t seed)
+{
+    for (auto it = wilderness_area_cache.begin(); it != wilderness_area_cache.end(); ++it) {
+        if ((it->wy != wy) || (it->wx != wx) || (it->seed != seed)) {
+            continue;
+        }
+
+        wilderness_area_cache.splice(wilderness_area_cache.begin(), wilderness_area_cache, it);
+        return &wilderness_area_cache.front().feats;
+    }
+
+    return nullptr;
+}
+
+/*!
+ * @brief 生成直後の荒野地形をキャッシュへ登録する
+ * @param floor_ptr 生成結果の入ったフロアへの参照ポインタ
+ * @param wy 広域Y座標
+ * @param wx 広域X座標
+ * @param seed 乱数の固定シード
+ */
+static void store_wilderness_area_cache(floor_type *floor_ptr, POSITION wy, POSITION wx, uint32_t seed)
+{
+    if (wilderness_area_cache.size() >= WILDERNESS_AREA_CACHE_SIZE) {
+        wilderness_area_cache.pop_back();
+    }
+
+    std::vector<FEAT_IDX> feats(MAX_HGT * MAX_WID);
+    for (POSITION y1 = 0; y1 < MAX_HGT; y1++) {
+        for (POSITION x1 = 0; x1 < MAX_WID; x1++) {
+            feats[y1 * MAX_WID + x1] = floor_ptr->grid_array[y1][x1].feat;
+        }
+    }
+
+    wilderness_area_cache.push_front({ wy, wx, seed, std::move(feats) });
+}
+
+/*!
+ * @brief キャッシュ済みの荒野地形をフロアへ書き戻す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param feats キャッシュ済みの地形データ
+ * @param strip_only 隣接区画の境界参照用ならばTRUE (外周1マス内側の帯だけを書き戻す)
+ */
+static void restore_wilderness_area_cache(floor_type *floor_ptr, const std::vector<FEAT_IDX> &feats, bool strip_only)
+{
+    if (!strip_only) {
+        for (POSITION y1 = 0; y1 < MAX_HGT; y1++) {
+            for (POSITION x1 = 0; x1 < MAX_WID; x1++) {
+                floor_ptr->grid_array[y1][x1].feat = feats[y1 * MAX_WID + x1];
+            }
+        }
+
+        return;
+    }
+
+    for (POSITION x1 = 1; x1 < MAX_WID - 1; x1++) {
+        floor_ptr->grid_array[1][x1].feat = feats[1 * MAX_WID + x1];
+        floor_ptr->grid_array[MAX_HGT - 2][x1].feat = feats[(MAX_HGT - 2) * MAX_WID + x1];
+    }
+
+    for (POSITION y1 = 1; y1 < MAX_HGT - 1; y1++) {
+        floor_ptr->grid_array[y1][1].feat = feats[y1 * MAX_WID + 1];
+        floor_ptr->grid_array[y1][MAX_WID - 2].feat = feats[y1 * MAX_WID + MAX_WID - 2];
+    }
+}
+
 /*!
  * @brief 荒野フロア生成のサブルーチン
+ * @param wy 広域Y座標
+ * @param wx 広域X座標
  * @param terrain 荒野地形ID
  * @param seed 乱数の固定シード
- * @param border 未使用
+ * @param border 広域マップの辺部分としての生成ならばTRUE
  * @param corner 広域マップの角部分としての生成ならばTRUE
+ * @details
+ * 辺・角としての生成では隣接区画の外周1マス内側しか参照されないため、
+ * キャッシュにあればその帯だけを書き戻してフラクタルの再生成を省く。
  */
-static void generate_wilderness_area(floor_type *floor_ptr, int terrain, uint32_t seed, bool corner)
+static void generate_wilderness_area(floor_type *floor_ptr, POSITION wy, POSITION wx, int terrain, uint32_t seed, bool border, bool corner)
 {
     if (terrain == TERRAIN_EDGE) {
         for (POSITION y1 = 0; y1 < MAX_HGT; y1++) {
@@ -242,6 +340,12 @@ static void generate_wilderness_area(floor_type *floor_ptr, int terrain, uint32_
         return;
     }
 
+    const auto *cached_feats = find_wilderness_area_cache(wy, wx, seed);
+    if (cached_feats != nullptr) {
+        restore_wilderness_area_cache(floor_ptr, *cached_feats, border || corner);
+        return;
+    }
+
     const auto state_backup = w_ptr->rng.get_state();
     w_ptr->rng.set_state(seed);
     int table_size = sizeof(terrain_table[0]) / sizeof(int16_t);
@@ -283,6 +387,7 @@ static void generate_wilderness_area(floor_type *floor_ptr, int terrain, uint32_
     }
 
     w_ptr->rng.set_state(state_backup);
+    store_wilderness_area_cache(floor_ptr, wy, wx, seed);
 }
 
 /*!
@@ -326,7 +431,7 @@ static void generate_area(PlayerType *player_ptr, POSITION y, POSITION x, bool b
     } else {
         int terrain = wilderness[y][x].terrain;
         uint32_t seed = wilderness[y][x].seed;
-        generate_wilderness_area(floor_ptr, terrain, seed, corner);
+        generate_wilderness_area(floor_ptr, y, x, terrain, seed, border, corner);
     }
 
     if (!corner && !wilderness[y][x].town) {
@@ -815,6 +920,7 @@ typedef wilderness_type *wilderness_type_ptr;
 errr init_wilderness(void)
 {
     wilderness.assign(w_ptr->max_wild_y, std::vector<wilderness_type>(w_ptr->max_wild_x));
+    wilderness_area_cache.clear();
 
     generate_encounter = false;
     return 0;
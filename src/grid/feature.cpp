@@ -223,6 +223,8 @@ void cave_set_feat(PlayerType *player_ptr, POSITION y, POSITION x, FEAT_IDX feat
     bool old_los = cave_has_flag_bold(floor_ptr, y, x, FloorFeatureType::LOS);
     bool old_mirror = g_ptr->is_mirror();
 
+    floor_ptr->sight_epoch++;
+    floor_ptr->terrain_epoch++;
     g_ptr->mimic = 0;
     g_ptr->feat = feat;
     g_ptr->info &= ~(CAVE_OBJECT);
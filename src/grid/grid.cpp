@@ -1094,6 +1094,8 @@ void place_bold(PlayerType *player_ptr, POSITION y, POSITION x, grid_bold_type g
 void set_cave_feat(floor_type *floor_ptr, POSITION y, POSITION x, FEAT_IDX feature_idx)
 {
     floor_ptr->grid_array[y][x].feat = feature_idx;
+    floor_ptr->sight_epoch++;
+    floor_ptr->terrain_epoch++;
 }
 
 /*!
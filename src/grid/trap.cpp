@@ -242,6 +242,8 @@ void place_trap(PlayerType *player_ptr, POSITION y, POSITION x)
     /* Place an invisible trap */
     g_ptr->mimic = g_ptr->feat;
     g_ptr->feat = choose_random_trap(player_ptr);
+    floor_ptr->sight_epoch++;
+    floor_ptr->terrain_epoch++;
 }
 
 /*!
@@ -3,6 +3,7 @@
 #include "core/window-redrawer.h"
 #include "flavor/flavor-describer.h"
 #include "floor/floor-object.h"
+#include "game-option/game-play-options.h"
 #include "inventory/inventory-slot-types.h"
 #include "object-hook/hook-weapon.h"
 #include "object/object-info.h"
@@ -10,12 +11,17 @@
 #include "object/object-stack.h"
 #include "object/object-value.h"
 #include "player-info/equipment-info.h"
+#include "player/player-realm.h"
 #include "spell-realm/spells-craft.h"
 #include "system/object-type-definition.h"
 #include "system/player-type-definition.h"
 #include "util/object-sort.h"
 #include "view/display-messages.h"
 #include "view/object-describer.h"
+#include "world/world.h"
+#include <algorithm>
+#include <array>
+#include <optional>
 
 void vary_item(PlayerType *player_ptr, INVENTORY_IDX item, ITEM_NUMBER num)
 {
@@ -151,15 +157,117 @@ void drop_from_inventory(PlayerType *player_ptr, INVENTORY_IDX item, ITEM_NUMBER
     vary_item(player_ptr, item, -amt);
 }
 
+namespace {
+
 /*!
- * @brief プレイヤーの所持スロットに存在するオブジェクトをまとめなおす /
- * Combine items in the pack
+ * @brief 所持スロットごとの真偽値 (溢れたアイテム用のスロットを含む)
+ */
+using PackSlotFlags = std::array<bool, INVEN_PACK + 1>;
+
+/*!
+ * @brief まとめ直し・並べ替えを終えた時点のザックの状態
  * @details
- * Note special handling of the "overflow" slot
+ * この時点のザックでは、どのアイテムの組もまとめられず、どのアイテムも並べ替える必要がない。
+ * よって状態も前後関係も変わっていないアイテム同士は、次のまとめ直し・並べ替えで調べなくてよい。
  */
-void combine_pack(PlayerType *player_ptr)
+struct pack_snapshot {
+    std::array<ObjectType, INVEN_PACK + 1> items{}; //!< 記録した時のアイテムの状態
+    PackSlotFlags is_aware{}; //!< 記録した時にアイテムの種類を知っていたか
+    ItemKindType realm1_book{}; //!< 記録した時の第1領域の魔法書
+    ItemKindType realm2_book{}; //!< 記録した時の第2領域の魔法書
+    bool stack_force_notes = false; //!< 記録した時の stack_force_notes オプション
+    bool stack_force_costs = false; //!< 記録した時の stack_force_costs オプション
+    bool valid = false; //!< 記録済か
+};
+
+/*!
+ * @brief ザックをまとめ直した結果
+ */
+struct pack_combination_result {
+    bool combined = false; //!< アイテムをまとめたか
+    int removed = 0; //!< まとめたことで空いた所持スロットの数
+};
+
+pack_snapshot combined_pack; //!< 最後にまとめ直した時点のザック
+pack_snapshot reordered_pack; //!< 最後に並べ替えた時点のザック
+
+/*!
+ * @brief 今のザックの状態を記録する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param snapshot 記録先
+ */
+void record_pack(PlayerType *player_ptr, pack_snapshot &snapshot)
+{
+    for (auto i = 0; i <= INVEN_PACK; i++) {
+        const auto &item = player_ptr->inventory_list[i];
+        snapshot.items[i] = item;
+        snapshot.is_aware[i] = (item.k_idx > 0) && item.is_aware();
+    }
+
+    snapshot.realm1_book = get_realm1_book(player_ptr);
+    snapshot.realm2_book = get_realm2_book(player_ptr);
+    snapshot.stack_force_notes = stack_force_notes;
+    snapshot.stack_force_costs = stack_force_costs;
+    snapshot.valid = true;
+}
+
+/*!
+ * @brief 記録した時点から変わったアイテムの所持スロットを返す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param snapshot 記録したザックの状態
+ * @details
+ * 記録と今のザックを先頭から順に突き合わせ、前後関係を保ったまま同じ状態で残っているアイテム以外を変わったものとする。
+ * アイテムを使い切ったり拾ったりしてスロットがずれても、ずれただけのアイテムは変わったものとしない。
+ * 魔法領域やオプションが記録した時と違う場合は、全てのアイテムを変わったものとする。
+ */
+PackSlotFlags find_changed_slots(PlayerType *player_ptr, const pack_snapshot &snapshot)
+{
+    PackSlotFlags changed{};
+    auto is_same_condition = snapshot.valid;
+    is_same_condition &= (snapshot.realm1_book == get_realm1_book(player_ptr)) && (snapshot.realm2_book == get_realm2_book(player_ptr));
+    is_same_condition &= (snapshot.stack_force_notes == stack_force_notes) && (snapshot.stack_force_costs == stack_force_costs);
+    if (!is_same_condition) {
+        changed.fill(true);
+        return changed;
+    }
+
+    auto next = 0;
+    for (auto i = 0; i <= INVEN_PACK; i++) {
+        const auto &item = player_ptr->inventory_list[i];
+        if (!item.k_idx) {
+            continue;
+        }
+
+        const auto is_aware = item.is_aware();
+        auto s = next;
+        while ((s <= INVEN_PACK) && (!snapshot.items[s].k_idx || (snapshot.is_aware[s] != is_aware) || !snapshot.items[s].is_same_state(&item))) {
+            s++;
+        }
+
+        if (s > INVEN_PACK) {
+            changed[i] = true;
+            continue;
+        }
+
+        next = s + 1;
+    }
+
+    return changed;
+}
+
+/*!
+ * @brief ザックの中のアイテムをまとめ直す
+ * @param pack まとめ直すザック
+ * @param changed 前回まとめ直してから変わったアイテムの所持スロット
+ * @return まとめ直した結果
+ * @details
+ * 後ろのアイテムから順に、それより前にある同じ種類のアイテムへまとめる。
+ * どちらのアイテムも変わっていない組は前回まとめられなかった組なので調べない。
+ * まとめたアイテムは変わったものとして扱う。
+ */
+pack_combination_result combine_pack_slots(ObjectType *pack, PackSlotFlags changed)
 {
-    bool flag = false;
+    pack_combination_result result;
     bool is_first_combination = true;
     bool combined = true;
     while (is_first_combination || combined) {
@@ -167,18 +275,20 @@ void combine_pack(PlayerType *player_ptr)
         combined = false;
 
         for (int i = INVEN_PACK; i > 0; i--) {
-            ObjectType *o_ptr;
-            o_ptr = &player_ptr->inventory_list[i];
+            auto *o_ptr = &pack[i];
             if (!o_ptr->k_idx) {
                 continue;
             }
             for (int j = 0; j < i; j++) {
-                ObjectType *j_ptr;
-                j_ptr = &player_ptr->inventory_list[j];
+                auto *j_ptr = &pack[j];
                 if (!j_ptr->k_idx) {
                     continue;
                 }
 
+                if (!changed[i] && !changed[j]) {
+                    continue;
+                }
+
                 /*
                  * Get maximum number of the stack if these
                  * are similar, get zero otherwise.
@@ -191,15 +301,16 @@ void combine_pack(PlayerType *player_ptr)
                 }
 
                 if (o_ptr->number + j_ptr->number <= max_num) {
-                    flag = true;
                     object_absorb(j_ptr, o_ptr);
-                    player_ptr->inven_cnt--;
+                    result.removed++;
                     int k;
                     for (k = i; k < INVEN_PACK; k++) {
-                        player_ptr->inventory_list[k] = player_ptr->inventory_list[k + 1];
+                        pack[k] = pack[k + 1];
+                        changed[k] = changed[k + 1];
                     }
 
-                    (&player_ptr->inventory_list[k])->wipe();
+                    (&pack[k])->wipe();
+                    changed[k] = false;
                 } else {
                     int old_num = o_ptr->number;
                     int remain = j_ptr->number + o_ptr->number - max_num;
@@ -213,49 +324,53 @@ void combine_pack(PlayerType *player_ptr)
                     if (o_ptr->tval == ItemKindType::WAND) {
                         o_ptr->pval = o_ptr->pval * remain / old_num;
                     }
+
+                    changed[i] = true;
                 }
 
-                player_ptr->window_flags |= (PW_INVEN);
+                changed[j] = true;
+                result.combined = true;
                 combined = true;
                 break;
             }
         }
     }
 
-    if (flag) {
-        msg_print(_("ザックの中のアイテムをまとめ直した。", "You combine some items in your pack."));
-    }
+    return result;
 }
 
 /*!
- * @brief プレイヤーの所持スロットに存在するオブジェクトを並び替える /
- * Reorder items in the pack
+ * @brief ザックの中のアイテムを並べ替える
  * @param player_ptr プレイヤーへの参照ポインタ
+ * @param pack 並べ替えるザック
+ * @param changed 前回並べ替えてから変わったアイテムの所持スロット
+ * @return 並べ替えたか
  * @details
- * Note special handling of the "overflow" slot
+ * 前のアイテムから順に、それより前で自分より下位の最初のアイテムの位置へ差し込む。
+ * 変わっていないアイテム同士は前回並べ替えた順に並んでいるため、
+ * 変わっていないアイテムは自分より前にある変わったアイテムや空きスロットとだけ比べる。
  */
-void reorder_pack(PlayerType *player_ptr)
+bool reorder_pack_slots(PlayerType *player_ptr, ObjectType *pack, PackSlotFlags changed)
 {
-    int i, j, k;
-    int32_t o_value;
-    ObjectType forge;
-    ObjectType *q_ptr;
-    ObjectType *o_ptr;
-    bool flag = false;
-
-    for (i = 0; i < INVEN_PACK; i++) {
-        if ((i == INVEN_PACK) && (player_ptr->inven_cnt == INVEN_PACK)) {
-            break;
-        }
-
-        o_ptr = &player_ptr->inventory_list[i];
+    auto reordered = false;
+    for (int i = 0; i < INVEN_PACK; i++) {
+        auto *o_ptr = &pack[i];
         if (!o_ptr->k_idx) {
             continue;
         }
 
-        o_value = object_value(o_ptr);
-        for (j = 0; j < INVEN_PACK; j++) {
-            if (object_sort_comp(player_ptr, o_ptr, o_value, &player_ptr->inventory_list[j])) {
+        std::optional<int32_t> o_value;
+        int j;
+        for (j = 0; j < i; j++) {
+            if (!changed[i] && !changed[j] && pack[j].k_idx) {
+                continue;
+            }
+
+            if (!o_value) {
+                o_value = object_value(o_ptr);
+            }
+
+            if (object_sort_comp(player_ptr, o_ptr, *o_value, &pack[j])) {
                 break;
             }
         }
@@ -264,18 +379,108 @@ void reorder_pack(PlayerType *player_ptr)
             continue;
         }
 
-        flag = true;
-        q_ptr = &forge;
-        q_ptr->copy_from(&player_ptr->inventory_list[i]);
-        for (k = i; k > j; k--) {
-            (&player_ptr->inventory_list[k])->copy_from(&player_ptr->inventory_list[k - 1]);
+        reordered = true;
+        ObjectType forge;
+        auto *q_ptr = &forge;
+        const auto is_changed = changed[i];
+        q_ptr->copy_from(&pack[i]);
+        for (int k = i; k > j; k--) {
+            (&pack[k])->copy_from(&pack[k - 1]);
+            changed[k] = changed[k - 1];
         }
 
-        (&player_ptr->inventory_list[j])->copy_from(q_ptr);
+        (&pack[j])->copy_from(q_ptr);
+        changed[j] = is_changed;
+    }
+
+    return reordered;
+}
+
+/*!
+ * @brief 2つのザックの中身が同じかを返す
+ */
+bool is_same_pack(const ObjectType *lhs, const ObjectType *rhs)
+{
+    for (auto i = 0; i <= INVEN_PACK; i++) {
+        if ((lhs[i].k_idx != rhs[i].k_idx) || !lhs[i].is_same_state(&rhs[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+/*!
+ * @brief プレイヤーの所持スロットに存在するオブジェクトをまとめなおす /
+ * Combine items in the pack
+ * @details
+ * Note special handling of the "overflow" slot\n
+ * 前回まとめ直してから変わったアイテムだけを調べる。
+ * デバッグモードでは全てのアイテムを調べた結果とも比べ、食い違えばそちらを採る。
+ */
+void combine_pack(PlayerType *player_ptr)
+{
+    auto *pack = player_ptr->inventory_list.get();
+    std::array<ObjectType, INVEN_PACK + 1> expected;
+    pack_combination_result expected_result;
+    if (w_ptr->wizard) {
+        std::copy(pack, pack + INVEN_PACK + 1, expected.begin());
+        PackSlotFlags all_changed;
+        all_changed.fill(true);
+        expected_result = combine_pack_slots(expected.data(), all_changed);
+    }
+
+    auto result = combine_pack_slots(pack, find_changed_slots(player_ptr, combined_pack));
+    if (w_ptr->wizard && ((result.removed != expected_result.removed) || !is_same_pack(pack, expected.data()))) {
+        msg_print(_("(まとめ直しの食い違い)", "(pack combination mismatch)"));
+        std::copy(expected.begin(), expected.end(), pack);
+        result = expected_result;
+    }
+
+    player_ptr->inven_cnt -= static_cast<int16_t>(result.removed);
+    if (result.combined) {
         player_ptr->window_flags |= (PW_INVEN);
     }
 
-    if (flag) {
+    record_pack(player_ptr, combined_pack);
+    if (result.removed > 0) {
+        msg_print(_("ザックの中のアイテムをまとめ直した。", "You combine some items in your pack."));
+    }
+}
+
+/*!
+ * @brief プレイヤーの所持スロットに存在するオブジェクトを並び替える /
+ * Reorder items in the pack
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @details
+ * Note special handling of the "overflow" slot\n
+ * 前回並べ替えてから変わったアイテムだけを差し込み直す。
+ * デバッグモードでは全てのアイテムを並べ替えた結果とも比べ、食い違えばそちらを採る。
+ */
+void reorder_pack(PlayerType *player_ptr)
+{
+    auto *pack = player_ptr->inventory_list.get();
+    std::array<ObjectType, INVEN_PACK + 1> expected;
+    auto expected_reordered = false;
+    if (w_ptr->wizard) {
+        std::copy(pack, pack + INVEN_PACK + 1, expected.begin());
+        PackSlotFlags all_changed;
+        all_changed.fill(true);
+        expected_reordered = reorder_pack_slots(player_ptr, expected.data(), all_changed);
+    }
+
+    auto reordered = reorder_pack_slots(player_ptr, pack, find_changed_slots(player_ptr, reordered_pack));
+    if (w_ptr->wizard && ((reordered != expected_reordered) || !is_same_pack(pack, expected.data()))) {
+        msg_print(_("(並べ替えの食い違い)", "(pack reorder mismatch)"));
+        std::copy(expected.begin(), expected.end(), pack);
+        reordered = expected_reordered;
+    }
+
+    record_pack(player_ptr, reordered_pack);
+    if (reordered) {
+        player_ptr->window_flags |= (PW_INVEN);
         msg_print(_("ザックの中のアイテムを並べ直した。", "You reorder some items in your pack."));
     }
 }
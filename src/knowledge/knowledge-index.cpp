@@ -0,0 +1,138 @@
+﻿/*!
+ * @brief 知識表示用のモンスター・アイテムの索引
+ * @date 2026/10/19
+ * @details
+ * グループごとの所属と並び順はモンスター種族・ベースアイテムの定義だけで決まるため、初めて使う時に一度だけ作る。
+ * 思い出や鑑定の状況で変わる「既知かどうか」は、表示する側が索引を順に見ながら判定する。
+ */
+
+#include "knowledge/knowledge-index.h"
+#include "knowledge/monster-group-table.h"
+#include "knowledge/object-group-table.h"
+#include "monster-race/monster-race.h"
+#include "monster-race/race-flags7.h"
+#include "object/object-kind.h"
+#include "object/tval-types.h"
+#include "system/monster-race-definition.h"
+#include "util/bit-flags-calculator.h"
+#include "util/string-processor.h"
+#include <algorithm>
+#include <tuple>
+
+/*!
+ * @brief モンスター種族がグループに属するかを返す
+ * @param r_ref モンスター種族への参照
+ * @param group_char グループのシンボル文字列 (特殊なグループは負の値)
+ * @return 属するならTRUE
+ * @details 賞金首は日ごとに変わるため、全てのモンスターを候補とする
+ */
+static bool is_in_monster_group(const monster_race &r_ref, concptr group_char)
+{
+    if (group_char == (char *)-1L) {
+        return r_ref.kind_flags.has(MonsterKindType::UNIQUE);
+    }
+
+    if (group_char == (char *)-2L) {
+        return any_bits(r_ref.flags7, RF7_RIDING);
+    }
+
+    if (group_char == (char *)-3L) {
+        return true;
+    }
+
+    if (group_char == (char *)-4L) {
+        return r_ref.kind_flags.has(MonsterKindType::AMBERITE);
+    }
+
+    return angband_strchr(group_char, r_ref.d_char) != nullptr;
+}
+
+/*!
+ * @brief モンスターのグループ別索引を返す
+ * @param grp_cur グループ種別 (monster_group_char の添字)
+ * @return 名前のあるモンスター種族をレベル順 (同レベルではユニークが後、その中はID順) に並べたリスト
+ * @details ang_sort_comp_monster_level() と同じ並び順になる
+ */
+const std::vector<MonsterRaceId> &get_monster_group_index(IDX grp_cur)
+{
+    static std::vector<std::vector<MonsterRaceId>> indexes;
+    if (indexes.empty()) {
+        std::vector<MonsterRaceId> races;
+        for (const auto &[r_idx, r_ref] : r_info) {
+            if (!r_ref.name.empty()) {
+                races.push_back(r_ref.idx);
+            }
+        }
+
+        std::sort(races.begin(), races.end(), [](auto r_idx1, auto r_idx2) {
+            const auto &r_ref1 = r_info[r_idx1];
+            const auto &r_ref2 = r_info[r_idx2];
+            return std::make_tuple(r_ref1.level, r_ref1.kind_flags.has(MonsterKindType::UNIQUE), r_idx1) < std::make_tuple(r_ref2.level, r_ref2.kind_flags.has(MonsterKindType::UNIQUE), r_idx2);
+        });
+
+        for (IDX i = 0; monster_group_text[i] != nullptr; i++) {
+            auto &index = indexes.emplace_back();
+            for (auto r_idx : races) {
+                if (is_in_monster_group(r_info[r_idx], monster_group_char[i])) {
+                    index.push_back(r_idx);
+                }
+            }
+        }
+    }
+
+    return indexes[grp_cur];
+}
+
+/*!
+ * @brief レベル・経験値順のモンスター索引を返す
+ * @return 有効で名前のあるモンスター種族をレベル順 (同レベルでは経験値順、その中はID順) に並べたリスト
+ * @details why = 2 の ang_sort_comp_hook() と同じ並び順になる
+ */
+const std::vector<MonsterRaceId> &get_monster_index_by_level_and_exp()
+{
+    static std::vector<MonsterRaceId> index;
+    if (index.empty()) {
+        for (const auto &[r_idx, r_ref] : r_info) {
+            if (MonsterRace(r_ref.idx).is_valid() && !r_ref.name.empty()) {
+                index.push_back(r_ref.idx);
+            }
+        }
+
+        std::sort(index.begin(), index.end(), [](auto r_idx1, auto r_idx2) {
+            const auto &r_ref1 = r_info[r_idx1];
+            const auto &r_ref2 = r_info[r_idx2];
+            return std::make_tuple(r_ref1.level, r_ref1.mexp, r_idx1) < std::make_tuple(r_ref2.level, r_ref2.mexp, r_idx2);
+        });
+    }
+
+    return index;
+}
+
+/*!
+ * @brief アイテムのグループ別索引を返す
+ * @param grp_cur グループ種別 (object_group_tval の添字)
+ * @return 名前のあるベースアイテムをID順に並べたリスト
+ */
+const std::vector<KIND_OBJECT_IDX> &get_object_group_index(IDX grp_cur)
+{
+    static std::vector<std::vector<KIND_OBJECT_IDX>> indexes;
+    if (indexes.empty()) {
+        indexes.resize(object_group_tval.size());
+        for (const auto &k_ref : k_info) {
+            if (k_ref.name.empty()) {
+                continue;
+            }
+
+            for (size_t i = 0; i < object_group_tval.size(); i++) {
+                const auto group_tval = object_group_tval[i];
+                const auto is_in_group = (group_tval == ItemKindType::LIFE_BOOK) ? (ItemKindType::LIFE_BOOK <= k_ref.tval && k_ref.tval <= ItemKindType::HEX_BOOK)
+                                                                                  : (k_ref.tval == group_tval);
+                if (is_in_group) {
+                    indexes[i].push_back(k_ref.idx);
+                }
+            }
+        }
+    }
+
+    return indexes[grp_cur];
+}
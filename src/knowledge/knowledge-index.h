@@ -0,0 +1,9 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include <vector>
+
+enum class MonsterRaceId : int16_t;
+const std::vector<MonsterRaceId> &get_monster_group_index(IDX grp_cur);
+const std::vector<MonsterRaceId> &get_monster_index_by_level_and_exp();
+const std::vector<KIND_OBJECT_IDX> &get_object_group_index(IDX grp_cur);
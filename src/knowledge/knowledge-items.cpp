@@ -14,6 +14,7 @@
 #include "inventory/inventory-slot-types.h"
 #include "io-dump/dump-util.h"
 #include "io/input-key-acceptor.h"
+#include "knowledge/knowledge-index.h"
 #include "knowledge/object-group-table.h"
 #include "object-enchant/special-object-flags.h"
 #include "object/object-kind-hook.h"
@@ -133,16 +134,14 @@ void do_cmd_knowledge_artifacts(PlayerType *player_ptr)
  *
  * mode & 0x01 : check for non-empty group
  * mode & 0x02 : visual operation only
+ *
+ * The objects are picked up from the prebuilt index of the group.
  */
 static KIND_OBJECT_IDX collect_objects(int grp_cur, KIND_OBJECT_IDX object_idx[], BIT_FLAGS8 mode)
 {
     KIND_OBJECT_IDX object_cnt = 0;
-    auto group_tval = object_group_tval[grp_cur];
-    for (const auto &k_ref : k_info) {
-        if (k_ref.name.empty()) {
-            continue;
-        }
-
+    for (auto k_idx : get_object_group_index(grp_cur)) {
+        const auto &k_ref = k_info[k_idx];
         if (!(mode & 0x02)) {
             if (!w_ptr->wizard) {
                 if (!k_ref.flavor) {
@@ -159,18 +158,7 @@ static KIND_OBJECT_IDX collect_objects(int grp_cur, KIND_OBJECT_IDX object_idx[]
             }
         }
 
-        if (group_tval == ItemKindType::LIFE_BOOK) {
-            if (ItemKindType::LIFE_BOOK <= k_ref.tval && k_ref.tval <= ItemKindType::HEX_BOOK) {
-                object_idx[object_cnt++] = k_ref.idx;
-            } else {
-                continue;
-            }
-        } else if (k_ref.tval == group_tval) {
-            object_idx[object_cnt++] = k_ref.idx;
-        } else {
-            continue;
-        }
-
+        object_idx[object_cnt++] = k_ref.idx;
         if (mode & 0x01) {
             break;
         }
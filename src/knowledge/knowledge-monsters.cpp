@@ -13,13 +13,13 @@
 #include "game-option/special-options.h"
 #include "io-dump/dump-util.h"
 #include "io/input-key-acceptor.h"
+#include "knowledge/knowledge-index.h"
 #include "knowledge/monster-group-table.h"
 #include "locale/english.h"
 #include "lore/lore-util.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/race-flags3.h"
-#include "monster-race/race-flags7.h"
 #include "monster/monster-describer.h"
 #include "monster/monster-description-types.h"
 #include "monster/monster-info.h"
@@ -35,7 +35,6 @@
 #include "util/angband-files.h"
 #include "util/bit-flags-calculator.h"
 #include "util/int-char-converter.h"
-#include "util/sort.h"
 #include "util/string-processor.h"
 #include "view/display-lore.h"
 #include "view/display-monster-status.h"
@@ -47,47 +46,28 @@
  * @param grp_cur グループ種別。リスト表記中の左一覧（各シンボル及び/ユニーク(-1)/騎乗可能モンスター(-2)/賞金首(-3)/アンバーの王族(-4)）を参照できる
  * @param mode 思い出の扱いに関するモード
  * @return 作成したモンスターのIDリスト
+ * @details
+ * レベル順に並べ済のグループ別索引から、今表示できるモンスターだけを順に拾う。
+ * MONSTER_LORE_NORMAL と MONSTER_LORE_DEBUG ではグループが空でないかだけを調べるため、最初の1体で打ち切る。
  */
 static std::vector<MonsterRaceId> collect_monsters(PlayerType *player_ptr, IDX grp_cur, monster_lore_mode mode)
 {
-    concptr group_char = monster_group_char[grp_cur];
-    bool grp_unique = (monster_group_char[grp_cur] == (char *)-1L);
-    bool grp_riding = (monster_group_char[grp_cur] == (char *)-2L);
     bool grp_wanted = (monster_group_char[grp_cur] == (char *)-3L);
-    bool grp_amberite = (monster_group_char[grp_cur] == (char *)-4L);
 
     std::vector<MonsterRaceId> r_idx_list;
-    for (const auto &[r_idx, r_ref] : r_info) {
-        if (r_ref.name.empty()) {
-            continue;
-        }
+    for (auto r_idx : get_monster_group_index(grp_cur)) {
+        const auto &r_ref = r_info[r_idx];
         if (((mode != MONSTER_LORE_DEBUG) && (mode != MONSTER_LORE_RESEARCH)) && !cheat_know && !r_ref.r_sights) {
             continue;
         }
 
-        if (grp_unique) {
-            if (r_ref.kind_flags.has_not(MonsterKindType::UNIQUE)) {
-                continue;
-            }
-        } else if (grp_riding) {
-            if (none_bits(r_ref.flags7, RF7_RIDING)) {
-                continue;
-            }
-        } else if (grp_wanted) {
+        if (grp_wanted) {
             auto wanted = player_ptr->knows_daily_bounty && (w_ptr->today_mon == r_ref.idx);
             wanted |= MonsterRace(r_ref.idx).is_bounty(false);
 
             if (!wanted) {
                 continue;
             }
-        } else if (grp_amberite) {
-            if (r_ref.kind_flags.has_not(MonsterKindType::AMBERITE)) {
-                continue;
-            }
-        } else {
-            if (!angband_strchr(group_char, r_ref.d_char)) {
-                continue;
-            }
         }
 
         r_idx_list.push_back(r_ref.idx);
@@ -99,8 +79,6 @@ static std::vector<MonsterRaceId> collect_monsters(PlayerType *player_ptr, IDX g
         }
     }
 
-    int dummy_why;
-    ang_sort(player_ptr, r_idx_list.data(), &dummy_why, r_idx_list.size(), ang_sort_comp_monster_level, ang_sort_swap_hook);
     return r_idx_list;
 }
 
@@ -184,18 +162,9 @@ void do_cmd_knowledge_kill_count(PlayerType *player_ptr)
         fprintf(fff, "You have defeated %ld %s.\n\n", (long int)total, (total == 1) ? "enemy" : "enemies");
 #endif
 
-    std::vector<MonsterRaceId> who;
     total = 0;
-    for (const auto &[r_idx, r_ref] : r_info) {
-        if (MonsterRace(r_ref.idx).is_valid() && !r_ref.name.empty()) {
-            who.push_back(r_ref.idx);
-        }
-    }
-
-    uint16_t why = 2;
     char buf[80];
-    ang_sort(player_ptr, who.data(), &why, who.size(), ang_sort_comp_hook, ang_sort_swap_hook);
-    for (auto r_idx : who) {
+    for (auto r_idx : get_monster_index_by_level_and_exp()) {
         auto *r_ptr = &r_info[r_idx];
         if (r_ptr->kind_flags.has(MonsterKindType::UNIQUE)) {
             bool dead = (r_ptr->max_num == 0);
@@ -8,16 +8,15 @@
 #include "core/show-file.h"
 #include "game-option/cheat-options.h"
 #include "io-dump/dump-util.h"
+#include "knowledge/knowledge-index.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "system/monster-race-definition.h"
 #include "system/player-type-definition.h"
 #include "util/angband-files.h"
-#include "util/sort.h"
 
 struct unique_list_type {
     bool is_alive;
-    uint16_t why;
     std::vector<MonsterRaceId> who;
     int num_uniques[10];
     int num_uniques_surface;
@@ -29,7 +28,6 @@ struct unique_list_type {
 unique_list_type *initialize_unique_lsit_type(unique_list_type *unique_list_ptr, bool is_alive)
 {
     unique_list_ptr->is_alive = is_alive;
-    unique_list_ptr->why = 2;
     unique_list_ptr->num_uniques_surface = 0;
     unique_list_ptr->num_uniques_over100 = 0;
     unique_list_ptr->num_uniques_total = 0;
@@ -145,10 +143,8 @@ void do_cmd_knowledge_uniques(PlayerType *player_ptr, bool is_alive)
         return;
     }
 
-    for (auto &[r_idx, r_ref] : r_info) {
-        if (!MonsterRace(r_ref.idx).is_valid()) {
-            continue;
-        }
+    for (auto r_idx : get_monster_index_by_level_and_exp()) {
+        auto &r_ref = r_info[r_idx];
         if (!sweep_uniques(&r_ref, unique_list_ptr->is_alive)) {
             continue;
         }
@@ -170,7 +166,6 @@ void do_cmd_knowledge_uniques(PlayerType *player_ptr, bool is_alive)
         unique_list_ptr->who.push_back(r_ref.idx);
     }
 
-    ang_sort(player_ptr, unique_list_ptr->who.data(), &unique_list_ptr->why, unique_list_ptr->who.size(), ang_sort_comp_hook, ang_sort_swap_hook);
     display_uniques(unique_list_ptr, fff);
     angband_fclose(fff);
     concptr title_desc = unique_list_ptr->is_alive ? _("まだ生きているユニーク・モンスター", "Alive Uniques") : _("もう撃破したユニーク・モンスター", "Dead Uniques");
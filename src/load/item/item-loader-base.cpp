@@ -1,4 +1,5 @@
 ﻿#include "load/item/item-loader-base.h"
+#include "flavor/flavor-describer.h"
 #include "load/angband-version-comparer.h"
 #include "load/load-util.h"
 #include "object/object-kind.h"
@@ -19,6 +20,8 @@ void ItemLoaderBase::load_item(void)
         k_ptr->tried = any_bits(tmp8u, 0x02);
     }
 
+    invalidate_object_descriptions();
+
     load_note(_("アイテムの記録をロードしました", "Loaded Object Memory"));
 }
 
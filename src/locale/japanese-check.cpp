@@ -0,0 +1,482 @@
+﻿/*!
+ * @file japanese-check.cpp
+ * @brief 日本語の文字コード変換の照合テスト / Round-trip checker for the Japanese encoding conversions
+ * @date 2026/10/19
+ * @details
+ * sjis2euc()・euc2sjis()・utf8_to_euc()・euc_to_utf8() の結果を、表引きと ASCII 読み飛ばしを入れる前の
+ * 素朴な実装 (reference 名前空間) と突き合わせる。make check から実行する。
+ * 日本語版でなければ何も調べずに 77 (automake のテストの SKIP) を返す。
+ */
+
+#include "locale/japanese.h"
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(JP) && defined(EUC)
+#include <iconv.h>
+#endif
+
+#ifdef JP
+namespace {
+/*!
+ * @brief 照合に用いる変更前の変換処理
+ */
+namespace reference {
+/*!
+ * @brief 文字コードをSJISからEUCに変換する (一時バッファを用いる変更前の実装)
+ * @param str 変換する文字列のポインタ
+ */
+void sjis2euc(char *str)
+{
+    int i;
+    unsigned char c1, c2;
+
+    int len = strlen(str);
+
+    std::vector<char> tmp(len + 1);
+
+    for (i = 0; i < len; i++) {
+        c1 = str[i];
+        if (c1 & 0x80) {
+            i++;
+            c2 = str[i];
+            if (c2 >= 0x9f) {
+                c1 = c1 * 2 - (c1 >= 0xe0 ? 0xe0 : 0x60);
+                c2 += 2;
+            } else {
+                c1 = c1 * 2 - (c1 >= 0xe0 ? 0xe1 : 0x61);
+                c2 += 0x60 + (c2 < 0x7f);
+            }
+            tmp[i - 1] = c1;
+            tmp[i] = c2;
+        } else {
+            tmp[i] = c1;
+        }
+    }
+    tmp[len] = 0;
+    strcpy(str, tmp.data());
+}
+
+/*!
+ * @brief 文字コードをEUCからSJISに変換する (一時バッファを用いる変更前の実装)
+ * @param str 変換する文字列のポインタ
+ */
+void euc2sjis(char *str)
+{
+    int i;
+    unsigned char c1, c2;
+
+    int len = strlen(str);
+
+    std::vector<char> tmp(len + 1);
+
+    for (i = 0; i < len; i++) {
+        c1 = str[i];
+        if (c1 & 0x80) {
+            i++;
+            c2 = str[i];
+            if (c1 % 2) {
+                c1 = (c1 >> 1) + (c1 < 0xdf ? 0x31 : 0x71);
+                c2 -= 0x60 + (c2 < 0xe0);
+            } else {
+                c1 = (c1 >> 1) + (c1 < 0xdf ? 0x30 : 0x70);
+                c2 -= 2;
+            }
+
+            tmp[i - 1] = c1;
+            tmp[i] = c2;
+        } else {
+            tmp[i] = c1;
+        }
+    }
+    tmp[len] = 0;
+    strcpy(str, tmp.data());
+}
+
+#ifdef EUC
+/*!
+ * @brief UTF-8文字列中の'～'と'－'をEUC-JPに変換できるコードポイントに置き換える (変更前の実装)
+ * @param str コードポイントの置き換えを行う文字列へのポインタ
+ */
+void ms_to_jis_unicode(char *str)
+{
+    static const struct ms_to_jis_unicode_conv_t {
+        unsigned char from[3];
+        unsigned char to[3];
+    } ms_to_jis_unicode_conv[] = {
+        { { 0xef, 0xbd, 0x9e }, { 0xe3, 0x80, 0x9c } }, /* FULLWIDTH TILDE -> WAVE DASH */
+        { { 0xef, 0xbc, 0x8d }, { 0xe2, 0x88, 0x92 } }, /* FULLWIDTH HYPHEN-MINUS -> MINUS SIGN */
+    };
+
+    unsigned char *p;
+    for (p = (unsigned char *)str; *p; p++) {
+        int subseq_num = 0;
+        if (0x00 < *p && *p <= 0x7f) {
+            continue;
+        }
+
+        if ((*p & 0xe0) == 0xc0) {
+            subseq_num = 1;
+        }
+        if ((*p & 0xf0) == 0xe0) {
+            size_t i;
+            for (i = 0; i < sizeof(ms_to_jis_unicode_conv) / sizeof(ms_to_jis_unicode_conv[0]); ++i) {
+                const struct ms_to_jis_unicode_conv_t *c = &ms_to_jis_unicode_conv[i];
+                if (memcmp(p, c->from, 3) == 0) {
+                    memcpy(p, c->to, 3);
+                }
+            }
+            subseq_num = 2;
+        }
+        if ((*p & 0xf8) == 0xf0) {
+            subseq_num = 3;
+        }
+
+        p += subseq_num;
+    }
+}
+
+/*!
+ * @brief 文字列の文字コードをUTF-8からEUC-JPに変換する (全体を iconv に通す変更前の実装)
+ * @param utf8_str 変換元の文字列へのポインタ
+ * @param utf8_str_len 変換元の文字列の長さ(文字数ではなくバイト数)
+ * @param euc_buf 変換した文字列を格納するバッファへのポインタ
+ * @param euc_buf_len 変換した文字列を格納するバッファのサイズ
+ * @return 変換に成功した場合変換後の文字列の長さ、失敗した場合-1を返す
+ */
+int utf8_to_euc(char *utf8_str, size_t utf8_str_len, char *euc_buf, size_t euc_buf_len)
+{
+    static iconv_t cd = nullptr;
+    if (!cd) {
+        cd = iconv_open("EUC-JP", "UTF-8");
+    }
+
+    ms_to_jis_unicode(utf8_str);
+
+    size_t inlen_left = utf8_str_len;
+    size_t outlen_left = euc_buf_len;
+    char *in = utf8_str;
+    char *out = euc_buf;
+
+    if (iconv(cd, &in, &inlen_left, &out, &outlen_left) == (size_t)-1) {
+        return -1;
+    }
+
+    return euc_buf_len - outlen_left;
+}
+
+/*!
+ * @brief 文字列の文字コードをEUC-JPからUTF-8に変換する (全体を iconv に通す変更前の実装)
+ * @param euc_str 変換元の文字列へのポインタ
+ * @param euc_str_len 変換元の文字列の長さ(文字数ではなくバイト数)
+ * @param utf8_buf 変換した文字列を格納するバッファへのポインタ
+ * @param utf8_buf_len 変換した文字列を格納するバッファのサイズ
+ * @return 変換に成功した場合変換後の文字列の長さ、失敗した場合-1を返す
+ */
+int euc_to_utf8(const char *euc_str, size_t euc_str_len, char *utf8_buf, size_t utf8_buf_len)
+{
+    static iconv_t cd = nullptr;
+    if (!cd) {
+        cd = iconv_open("UTF-8", "EUC-JP");
+    }
+
+    size_t inlen_left = euc_str_len;
+    size_t outlen_left = utf8_buf_len;
+    const char *in = euc_str;
+    char *out = utf8_buf;
+
+    if (iconv(cd, (char **)&in, &inlen_left, &out, &outlen_left) == (size_t)-1) {
+        return -1;
+    }
+
+    return utf8_buf_len - outlen_left;
+}
+#endif
+}
+
+/*!
+ * @brief 2バイト文字の前後に置く ASCII 文字列の長さ (8バイト単位の読み飛ばしの境界をまたぐように選ぶ)
+ */
+const std::vector<size_t> ASCII_CONTEXT_LENGTHS = { 0, 1, 7, 8, 9, 15, 16, 17 };
+
+/*!
+ * @brief 乱数で作る文字列の数
+ */
+constexpr int RANDOM_STRING_COUNT = 200000;
+
+int check_count = 0; //!< 照合した回数
+int failure_count = 0; //!< 一致しなかった回数
+
+/*!
+ * @brief 文字列を16進数で書き出す
+ * @param str 書き出す文字列
+ * @return 16進数表記の文字列
+ */
+std::string to_hex(const std::string &str)
+{
+    std::string hex;
+    char buf[4];
+    for (const auto c : str) {
+        sprintf(buf, "%02x ", static_cast<unsigned char>(c));
+        hex += buf;
+    }
+
+    return hex;
+}
+
+/*!
+ * @brief 照合結果を記録し、一致しなかった場合は最初の数件を報告する
+ * @param is_matched 一致したか
+ * @param name 照合した処理の名前
+ * @param input 入力した文字列
+ */
+void record(bool is_matched, const char *name, const std::string &input)
+{
+    check_count++;
+    if (is_matched) {
+        return;
+    }
+
+    failure_count++;
+    if (failure_count <= 20) {
+        fprintf(stderr, "%s: mismatch for input [ %s]\n", name, to_hex(input).data());
+    }
+}
+
+/*!
+ * @brief その場で書き換える変換を変更前の実装と照合する
+ * @param name 照合する処理の名前
+ * @param convert 照合する変換処理
+ * @param reference_convert 変更前の変換処理
+ * @param str 変換する文字列 ('\\0' を含まないこと)
+ */
+void check_in_place(const char *name, void (*convert)(char *), void (*reference_convert)(char *), const std::string &str)
+{
+    std::vector<char> actual(str.begin(), str.end());
+    actual.push_back('\0');
+    auto expected = actual;
+    convert(actual.data());
+    reference_convert(expected.data());
+    record(strcmp(actual.data(), expected.data()) == 0, name, str);
+}
+
+/*!
+ * @brief sjis2euc() と euc2sjis() を変更前の実装と照合する
+ * @param str 変換する文字列 ('\\0' を含まないこと)
+ */
+void check_sjis_euc(const std::string &str)
+{
+    check_in_place("sjis2euc", sjis2euc, reference::sjis2euc, str);
+    check_in_place("euc2sjis", euc2sjis, reference::euc2sjis, str);
+}
+
+/*!
+ * @brief SJISとEUCを往復させて元に戻るか調べる
+ * @param str 変換する文字列
+ * @param is_sjis strがSJISならtrue、EUCならfalse
+ */
+void check_round_trip(const std::string &str, bool is_sjis)
+{
+    std::vector<char> buf(str.begin(), str.end());
+    buf.push_back('\0');
+    if (is_sjis) {
+        sjis2euc(buf.data());
+        euc2sjis(buf.data());
+    } else {
+        euc2sjis(buf.data());
+        sjis2euc(buf.data());
+    }
+
+    record(str == buf.data(), is_sjis ? "sjis2euc -> euc2sjis" : "euc2sjis -> sjis2euc", str);
+}
+
+/*!
+ * @brief 全ての1バイト目・2バイト目の組を、前後に ASCII 文字を置いて照合する
+ */
+void sweep_kanji_pairs()
+{
+    const std::string ascii = "0123456789abcdefghijklmnopqrstuvwxyz";
+    for (auto c1 = 0x01; c1 <= 0xff; c1++) {
+        for (auto c2 = 0x01; c2 <= 0xff; c2++) {
+            const std::string pair = { static_cast<char>(c1), static_cast<char>(c2) };
+            for (const auto prefix_len : ASCII_CONTEXT_LENGTHS) {
+                for (const auto suffix_len : ASCII_CONTEXT_LENGTHS) {
+                    check_sjis_euc(ascii.substr(0, prefix_len) + pair + ascii.substr(0, suffix_len));
+                }
+            }
+        }
+
+        /* 末尾が2バイト文字の1バイト目で終わっている場合 */
+        for (const auto prefix_len : ASCII_CONTEXT_LENGTHS) {
+            check_sjis_euc(ascii.substr(0, prefix_len) + static_cast<char>(c1));
+        }
+    }
+
+    for (auto c1 = 0x81; c1 <= 0xef; c1++) {
+        if ((c1 > 0x9f) && (c1 < 0xe0)) {
+            continue;
+        }
+
+        for (auto c2 = 0x40; c2 <= 0xfc; c2++) {
+            if (c2 != 0x7f) {
+                check_round_trip(ascii.substr(0, c2 % 17) + static_cast<char>(c1) + static_cast<char>(c2), true);
+            }
+        }
+    }
+
+    for (auto c1 = 0xa1; c1 <= 0xfe; c1++) {
+        for (auto c2 = 0xa1; c2 <= 0xfe; c2++) {
+            check_round_trip(ascii.substr(0, c2 % 17) + static_cast<char>(c1) + static_cast<char>(c2), false);
+        }
+    }
+}
+
+/*!
+ * @brief ASCII 文字・EUCの2バイト文字・任意のバイトを混ぜた文字列を作る
+ * @param rng 乱数生成器
+ * @param len 文字数
+ * @param allows_any_byte ASCII とEUCの2バイト文字以外のバイトを混ぜるか
+ * @return 作った文字列 ('\\0' は含まない)
+ */
+std::string make_random_string(std::mt19937 &rng, int len, bool allows_any_byte)
+{
+    std::string str;
+    for (auto i = 0; i < len; i++) {
+        switch (rng() % (allows_any_byte ? 3 : 2)) {
+        case 0:
+            str += static_cast<char>(0x20 + rng() % 0x5f);
+            break;
+        case 1:
+            str += static_cast<char>(0xb0 + rng() % 0x30);
+            str += static_cast<char>(0xa1 + rng() % 0x5e);
+            break;
+        default:
+            str += static_cast<char>(0x01 + rng() % 0xff);
+            break;
+        }
+    }
+
+    return str;
+}
+
+/*!
+ * @brief 乱数で作った文字列で sjis2euc() と euc2sjis() を照合する
+ * @param rng 乱数生成器
+ */
+void check_random_sjis_euc(std::mt19937 &rng)
+{
+    for (auto i = 0; i < RANDOM_STRING_COUNT; i++) {
+        check_sjis_euc(make_random_string(rng, rng() % 40, (i % 2) != 0));
+    }
+}
+
+#ifdef EUC
+/*!
+ * @brief iconv を用いる変換を、全ての出力バッファの長さについて変更前の実装と照合する
+ * @param name 照合する処理の名前
+ * @param convert 照合する変換処理
+ * @param reference_convert 変更前の変換処理
+ * @param str 変換する文字列
+ * @param includes_terminator 終端の'\\0'も変換するか
+ * @return 十分な長さのバッファで変更前の実装が変換した結果 (失敗した場合は空文字列)
+ * @details 変換に成功した場合は出力先に書いた内容も照合する。どちらの実装も入力を書き換えることがあるため、その都度複製して渡す
+ */
+template <typename Convert, typename ReferenceConvert>
+std::string check_iconv(const char *name, Convert convert, ReferenceConvert reference_convert, const std::string &str, bool includes_terminator)
+{
+    const auto input_len = str.size() + (includes_terminator ? 1 : 0);
+    const auto full_len = str.size() * 3 + 8;
+    std::string full_result;
+    for (size_t buf_len = 0; buf_len <= full_len; buf_len++) {
+        std::vector<char> input(str.begin(), str.end());
+        input.push_back('\0');
+        auto reference_input = input;
+        std::vector<char> actual(buf_len + 1, '\x7f');
+        std::vector<char> expected(buf_len + 1, '\x7f');
+        const auto actual_len = convert(input.data(), input_len, actual.data(), buf_len);
+        const auto expected_len = reference_convert(reference_input.data(), input_len, expected.data(), buf_len);
+        const auto is_matched = (actual_len == expected_len) && ((actual_len < 0) || (memcmp(actual.data(), expected.data(), actual_len) == 0));
+        record(is_matched, name, str);
+        if ((buf_len == full_len) && (expected_len > 0)) {
+            full_result.assign(expected.data(), expected_len);
+        }
+    }
+
+    return full_result;
+}
+
+/*!
+ * @brief utf8_to_euc() と euc_to_utf8() を照合する
+ * @param euc EUC-JPの文字列 ('\\0' を含まないこと)
+ * @param includes_terminator 終端の'\\0'も変換するか
+ */
+void check_euc_utf8(const std::string &euc, bool includes_terminator)
+{
+    auto utf8 = check_iconv("euc_to_utf8", euc_to_utf8, reference::euc_to_utf8, euc, includes_terminator);
+    if (utf8.empty()) {
+        return;
+    }
+
+    if (includes_terminator) {
+        utf8.pop_back();
+    }
+
+    (void)check_iconv("utf8_to_euc", utf8_to_euc, reference::utf8_to_euc, utf8, includes_terminator);
+}
+
+/*!
+ * @brief EUC-JPの2バイト文字の全ての組と乱数で作った文字列で、UTF-8との相互変換を照合する
+ * @param rng 乱数生成器
+ * @details 出力バッファは足りない長さから十分な長さまで全て試す
+ */
+void check_iconv_conversions(std::mt19937 &rng)
+{
+    const std::string ascii = "0123456789abcdefghijklmnopqrstuvwxyz";
+    for (auto c1 = 0xa1; c1 <= 0xfe; c1++) {
+        for (auto c2 = 0xa1; c2 <= 0xfe; c2++) {
+            const auto prefix_len = ASCII_CONTEXT_LENGTHS[c2 % ASCII_CONTEXT_LENGTHS.size()];
+            const auto suffix_len = ASCII_CONTEXT_LENGTHS[c1 % ASCII_CONTEXT_LENGTHS.size()];
+            const auto euc = ascii.substr(0, prefix_len) + static_cast<char>(c1) + static_cast<char>(c2) + ascii.substr(0, suffix_len);
+            check_euc_utf8(euc, (c2 % 2) != 0);
+        }
+    }
+
+    /* Windows環境のUTF-8の'～'と'－' */
+    for (const auto prefix_len : ASCII_CONTEXT_LENGTHS) {
+        const auto utf8 = ascii.substr(0, prefix_len) + "\xef\xbd\x9e\xef\xbc\x8d" + ascii.substr(0, prefix_len);
+        (void)check_iconv("utf8_to_euc", utf8_to_euc, reference::utf8_to_euc, utf8, true);
+        (void)check_iconv("utf8_to_euc", utf8_to_euc, reference::utf8_to_euc, utf8, false);
+    }
+
+    for (auto i = 0; i < RANDOM_STRING_COUNT / 100; i++) {
+        const auto str = make_random_string(rng, rng() % 20, (i % 4) == 0);
+        check_euc_utf8(str, (i % 2) != 0);
+        (void)check_iconv("utf8_to_euc", utf8_to_euc, reference::utf8_to_euc, str, (i % 2) != 0);
+    }
+}
+#endif
+}
+#endif
+
+/*!
+ * @brief 日本語の文字コード変換の照合テストのメイン関数
+ * @return 全て一致すれば0、一致しないものがあれば1、日本語版でなければ77を返す
+ */
+int main()
+{
+#ifdef JP
+    std::mt19937 rng(20261019);
+    sweep_kanji_pairs();
+    check_random_sjis_euc(rng);
+#ifdef EUC
+    check_iconv_conversions(rng);
+#endif
+    printf("japanese-check: %d checks, %d failures\n", check_count, failure_count);
+    return failure_count == 0 ? 0 : 1;
+#else
+    printf("japanese-check: skipped (not a Japanese build)\n");
+    return 77;
+#endif
+}
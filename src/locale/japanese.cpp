@@ -8,6 +8,10 @@
 #include "locale/utf-8.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
 
 #ifdef JP
 
@@ -159,77 +163,138 @@ void jverb(concptr in, char *out, int flag)
     }
 }
 
+namespace {
 /*!
- * @brief 文字コードをSJISからEUCに変換する / Convert SJIS string to EUC string
- * @param str 変換する文字列のポインタ
- * @details
+ * @brief 8バイト単位で ASCII 文字のみかを調べる際に用いる最上位ビットのマスク
  */
-void sjis2euc(char *str)
+constexpr uint64_t NON_ASCII_MASK = 0x8080808080808080ULL;
+
+/*!
+ * @brief 文字列の先頭から続く ASCII 文字の長さを返す
+ * @param str 調べる文字列へのポインタ
+ * @param len 調べる長さ(バイト数)
+ * @return 先頭から続く ASCII 文字のバイト数
+ * @details 8バイトずつまとめて調べ、非ASCII文字を含むブロックに当たった所から1バイトずつ調べる
+ */
+size_t ascii_prefix_length(concptr str, size_t len)
 {
-    int i;
-    unsigned char c1, c2;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+        uint64_t block;
+        memcpy(&block, str + i, sizeof(block));
+        if (block & NON_ASCII_MASK) {
+            break;
+        }
+    }
 
-    int len = strlen(str);
+    while ((i < len) && !(static_cast<unsigned char>(str[i]) & 0x80)) {
+        i++;
+    }
 
-    std::vector<char> tmp(len + 1);
+    return i;
+}
 
-    for (i = 0; i < len; i++) {
-        c1 = str[i];
-        if (c1 & 0x80) {
-            i++;
-            c2 = str[i];
-            if (c2 >= 0x9f) {
-                c1 = c1 * 2 - (c1 >= 0xe0 ? 0xe0 : 0x60);
-                c2 += 2;
-            } else {
-                c1 = c1 * 2 - (c1 >= 0xe0 ? 0xe1 : 0x61);
-                c2 += 0x60 + (c2 < 0x7f);
-            }
-            tmp[i - 1] = c1;
-            tmp[i] = c2;
-        } else {
-            tmp[i] = c1;
-        }
+/*!
+ * @brief 2バイト文字の1バイトごとの変換表
+ */
+using kanji_byte_table = std::array<unsigned char, 256>;
+
+/*!
+ * @brief 変換表を生成する
+ * @param convert 1バイト分の変換式
+ * @return 全てのバイト値についての変換結果
+ */
+template <typename Convert>
+constexpr kanji_byte_table make_kanji_byte_table(Convert convert)
+{
+    kanji_byte_table table{};
+    for (int c = 0; c < 256; c++) {
+        table[c] = static_cast<unsigned char>(convert(c));
     }
-    tmp[len] = 0;
-    strcpy(str, tmp.data());
+
+    return table;
 }
 
 /*!
- * @brief 文字コードをEUCからSJISに変換する / Convert EUC string to SJIS string
- * @param str 変換する文字列のポインタ
- * @details
+ * @brief SJISの1バイト目→EUCの1バイト目 (2バイト目が0x9f以上の場合。未満の場合はここから1を引く)
  */
-void euc2sjis(char *str)
-{
-    int i;
-    unsigned char c1, c2;
+constexpr auto sjis_lead_to_euc = make_kanji_byte_table([](int c) { return c * 2 - (c >= 0xe0 ? 0xe0 : 0x60); });
 
-    int len = strlen(str);
+/*!
+ * @brief SJISの2バイト目→EUCの2バイト目
+ */
+constexpr auto sjis_trail_to_euc = make_kanji_byte_table([](int c) { return (c >= 0x9f) ? c + 2 : c + 0x60 + (c < 0x7f); });
 
-    std::vector<char> tmp(len + 1);
+/*!
+ * @brief EUCの1バイト目→SJISの1バイト目
+ */
+constexpr auto euc_lead_to_sjis = make_kanji_byte_table([](int c) { return (c >> 1) + (c < 0xdf ? 0x30 : 0x70) + (c % 2); });
 
-    for (i = 0; i < len; i++) {
-        c1 = str[i];
-        if (c1 & 0x80) {
-            i++;
-            c2 = str[i];
-            if (c1 % 2) {
-                c1 = (c1 >> 1) + (c1 < 0xdf ? 0x31 : 0x71);
-                c2 -= 0x60 + (c2 < 0xe0);
-            } else {
-                c1 = (c1 >> 1) + (c1 < 0xdf ? 0x30 : 0x70);
-                c2 -= 2;
-            }
+/*!
+ * @brief EUCの2バイト目→SJISの2バイト目 (1バイト目が奇数の場合)
+ */
+constexpr auto euc_trail_to_sjis_odd = make_kanji_byte_table([](int c) { return c - (0x60 + (c < 0xe0)); });
+
+/*!
+ * @brief EUCの2バイト目→SJISの2バイト目 (1バイト目が偶数の場合)
+ */
+constexpr auto euc_trail_to_sjis_even = make_kanji_byte_table([](int c) { return c - 2; });
+
+/*!
+ * @brief 2バイト文字を1文字ずつ変換表で置き換える
+ * @param str 変換する文字列のポインタ
+ * @param convert 2バイト文字1文字分の変換処理
+ * @details
+ * SJISとEUCの相互変換ではバイト数が変わらないため、一時バッファを用いずにその場で書き換える。
+ * ASCII文字の並びは8バイト単位で読み飛ばす。
+ * 文字列末尾が2バイト文字の1バイト目で終わっている場合は、2バイト目を'\\0'とみなして1バイト目のみを変換する。
+ */
+template <typename Convert>
+void convert_kanji_in_place(char *str, Convert convert)
+{
+    const size_t len = strlen(str);
+    auto *bytes = reinterpret_cast<unsigned char *>(str);
+    for (size_t i = 0; i < len; i++) {
+        i += ascii_prefix_length(str + i, len - i);
+        if (i >= len) {
+            break;
+        }
 
-            tmp[i - 1] = c1;
-            tmp[i] = c2;
-        } else {
-            tmp[i] = c1;
+        const unsigned char c1 = bytes[i];
+        const unsigned char c2 = (i + 1 < len) ? bytes[i + 1] : 0;
+        const auto [euc1, euc2] = convert(c1, c2);
+        bytes[i] = euc1;
+        if (++i < len) {
+            bytes[i] = euc2;
         }
     }
-    tmp[len] = 0;
-    strcpy(str, tmp.data());
+}
+}
+
+/*!
+ * @brief 文字コードをSJISからEUCに変換する / Convert SJIS string to EUC string
+ * @param str 変換する文字列のポインタ
+ * @details
+ */
+void sjis2euc(char *str)
+{
+    convert_kanji_in_place(str, [](unsigned char c1, unsigned char c2) {
+        const unsigned char lead = sjis_lead_to_euc[c1] - (c2 < 0x9f);
+        return std::make_pair(lead, sjis_trail_to_euc[c2]);
+    });
+}
+
+/*!
+ * @brief 文字コードをEUCからSJISに変換する / Convert EUC string to SJIS string
+ * @param str 変換する文字列のポインタ
+ * @details
+ */
+void euc2sjis(char *str)
+{
+    convert_kanji_in_place(str, [](unsigned char c1, unsigned char c2) {
+        const auto &trail_table = (c1 % 2) ? euc_trail_to_sjis_odd : euc_trail_to_sjis_even;
+        return std::make_pair(euc_lead_to_sjis[c1], trail_table[c2]);
+    });
 }
 
 /*!
@@ -334,22 +399,6 @@ bool iskanji2(concptr s, int x)
     return false;
 }
 
-/*!
- * @brief 文字列の文字コードがASCIIかどうかを判定する
- * @param str 判定する文字列へのポインタ
- * @return 文字列の文字コードがASCIIならTRUE、そうでなければFALSE
- */
-static bool is_ascii_str(concptr str)
-{
-    for (; *str; str++) {
-        int ch = *str;
-        if (!(0x00 < ch && ch <= 0x7f)) {
-            return false;
-        }
-    }
-    return true;
-}
-
 #if defined(EUC)
 #include <iconv.h>
 
@@ -413,6 +462,30 @@ static void ms_to_jis_unicode(char *str)
 #endif
 
 #ifdef EUC
+/*!
+ * @brief 変換元の文字列の先頭から続く ASCII 文字を変換せずに出力先へ書き写す
+ * @param in 変換元の文字列へのポインタ。書き写した分だけ進める
+ * @param inlen_left 変換元の残りの長さ。書き写した分だけ減らす
+ * @param out 出力先のバッファへのポインタ。書き写した分だけ進める
+ * @param outlen_left 出力先の残りの長さ。書き写した分だけ減らす
+ * @return 出力先に書き写しきれた場合TRUE、バッファが足りない場合FALSEを返す
+ * @details ASCII文字はUTF-8とEUC-JPで同じバイト列になるため、iconv を通さずにまとめて書き写す
+ */
+static bool copy_ascii_prefix(const char *&in, size_t &inlen_left, char *&out, size_t &outlen_left)
+{
+    const auto ascii_len = ascii_prefix_length(in, inlen_left);
+    if (ascii_len > outlen_left) {
+        return false;
+    }
+
+    memcpy(out, in, ascii_len);
+    in += ascii_len;
+    inlen_left -= ascii_len;
+    out += ascii_len;
+    outlen_left -= ascii_len;
+    return true;
+}
+
 /*!
  * @brief 文字列の文字コードをUTF-8からEUC-JPに変換する
  * @param utf8_str 変換元の文字列へのポインタ
@@ -429,14 +502,22 @@ int utf8_to_euc(char *utf8_str, size_t utf8_str_len, char *euc_buf, size_t euc_b
         cd = iconv_open("EUC-JP", "UTF-8");
     }
 
-    ms_to_jis_unicode(utf8_str);
-
     size_t inlen_left = utf8_str_len;
     size_t outlen_left = euc_buf_len;
-    char *in = utf8_str;
+    const char *in = utf8_str;
     char *out = euc_buf;
+    if (!copy_ascii_prefix(in, inlen_left, out, outlen_left)) {
+        return -1;
+    }
 
-    if (iconv(cd, &in, &inlen_left, &out, &outlen_left) == (size_t)-1) {
+    if (inlen_left == 0) {
+        return euc_buf_len - outlen_left;
+    }
+
+    ms_to_jis_unicode(utf8_str + (utf8_str_len - inlen_left));
+
+    // iconv は入力バッファを書き換えないのでキャストで const を外してよい
+    if (iconv(cd, (char **)&in, &inlen_left, &out, &outlen_left) == (size_t)-1) {
         return -1;
     }
 
@@ -463,6 +544,13 @@ int euc_to_utf8(const char *euc_str, size_t euc_str_len, char *utf8_buf, size_t
     size_t outlen_left = utf8_buf_len;
     const char *in = euc_str;
     char *out = utf8_buf;
+    if (!copy_ascii_prefix(in, inlen_left, out, outlen_left)) {
+        return -1;
+    }
+
+    if (inlen_left == 0) {
+        return utf8_buf_len - outlen_left;
+    }
 
     // iconv は入力バッファを書き換えないのでキャストで const を外してよい
     if (iconv(cd, (char **)&in, &inlen_left, &out, &outlen_left) == (size_t)-1) {
@@ -517,17 +605,22 @@ static bool utf8_to_sys(char *utf8_str, char *sys_str_buffer, size_t sys_str_buf
  */
 void guess_convert_to_system_encoding(char *strbuf, int buflen)
 {
-    if (is_ascii_str(strbuf)) {
+    const auto len = strlen(strbuf);
+    const auto ascii_len = ascii_prefix_length(strbuf, len);
+    if (ascii_len == len) {
         return;
     }
 
-    if (is_utf8_str(strbuf)) {
-        std::vector<char> work(buflen);
-        angband_strcpy(work.data(), strbuf, buflen);
-        if (!utf8_to_sys(work.data(), strbuf, buflen)) {
-            msg_print("警告:文字コードの変換に失敗しました");
-            msg_print(nullptr);
-        }
+    /* 先頭の ASCII 文字はどの文字コードでも同じなので、それ以降のみを変換する */
+    auto *rest = strbuf + ascii_len;
+    if (!is_utf8_str(rest)) {
+        return;
+    }
+
+    std::string work(rest);
+    if (!utf8_to_sys(work.data(), rest, buflen - ascii_len)) {
+        msg_print("警告:文字コードの変換に失敗しました");
+        msg_print(nullptr);
     }
 }
 
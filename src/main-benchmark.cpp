@@ -0,0 +1,386 @@
+﻿/* File: main-benchmark.cpp */
+
+/*!
+ * @brief ゲームターンの計測 / Turn loop benchmark
+ * @date 2026/10/19
+ * @details
+ * セーブファイルを読み込んで画面なしで指定ターン数だけ process_dungeon() のループを回し、
+ * process_player()・process_monsters()・WorldTurnProcessor::process_world()・
+ * handle_stuff()・term_fresh_force() のゲームターンごとの所要時間の分布をJSONで出力する。
+ * <pre>
+ * hengband-benchmark -u<name> [-n<turns>] [-w<turns>] [-d<dungeon>,<level>[,<seed>]] [-b<count>] [-s<label>] [-o<file>] [-- <headless sub options>]
+ *   -u<name>   読み込むセーブファイル (キャラクター名)
+ *   -n<turns>  計測するゲームターン数 (既定値 1000)
+ *   -w<turns>  計測前に回すゲームターン数 (既定値 10)
+ *   -d<dungeon>,<level>[,<seed>]  計測前に指定したダンジョン・階層の新しいフロアへ移動する (シードを与えるとフロアが再現する)
+ *   -b<count>  計測前にプレイヤーの周りへ増殖するモンスターを召喚する数
+ *   -s<label>  出力に記録するシナリオ名
+ *   -o<file>   出力先 (既定は標準出力)
+ * </pre>
+ * headless のサブオプションを省略した場合は「ESC、その場にとどまる」を繰り返す。
+ * 計測中のキャラクターは死亡しない (cheat_immortal)。
+ * セーブファイルは複製 (<セーブファイル>.benchmark) を読み込んで計測し、終了時に削除するので元のファイルは書き換えない。
+ */
+
+#include "core/game-play.h"
+#include "dungeon/dungeon-processor.h"
+#include "floor/floor-leaver.h"
+#include "floor/floor-save.h"
+#include "game-option/cheat-options.h"
+#include "game-option/game-play-options.h"
+#include "game-option/special-options.h"
+#include "io/files-util.h"
+#include "io/signal-handlers.h"
+#include "io/uid-checker.h"
+#include "main-headless.h"
+#include "main/angband-initializer.h"
+#include "monster-floor/monster-summon.h"
+#include "monster-floor/place-monster-types.h"
+#include "monster-race/monster-race.h"
+#include "monster-race/race-flags2.h"
+#include "monster-race/race-kind-flags.h"
+#include "player/process-name.h"
+#include "system/angband.h"
+#include "system/floor-type-definition.h"
+#include "system/monster-race-definition.h"
+#include "system/player-type-definition.h"
+#include "system/system-variables.h"
+#include "term/gameterm.h"
+#include "term/z-form.h"
+#include "term/z-term.h"
+#include "term/z-util.h"
+#include "util/angband-files.h"
+#include "util/bit-flags-calculator.h"
+#include "util/enum-converter.h"
+#include "util/string-processor.h"
+#include "world/world.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+/*!
+ * @brief 処理の区分の出力名 (TurnPhase の並び順)
+ */
+const std::array<concptr, enum2i(TurnPhase::MAX)> TURN_PHASE_NAMES = { {
+    "process_player",
+    "process_monsters",
+    "process_world",
+    "handle_stuff",
+    "term_fresh_force",
+    "turn",
+} };
+
+int measure_turns = 1000; //!< 計測するゲームターン数
+int warmup_turns = 10; //!< 計測前に回すゲームターン数
+int breeder_count = 0; //!< 計測前に召喚する増殖モンスターの数
+int jump_dungeon_idx = 0; //!< 計測前に移動するダンジョン (0なら移動しない)
+int jump_level = 0; //!< 計測前に移動する階層
+unsigned int jump_seed = 0; //!< 移動先のフロアを生成する乱数のシード (0なら固定しない)
+std::string scenario = "savefile"; //!< 出力に記録するシナリオ名
+std::string output_path; //!< 出力先 (空なら標準出力)
+
+int passed_turns = 0; //!< 経過したゲームターン数 (計測前のターンを含む)
+std::array<double, enum2i(TurnPhase::MAX)> current_turn_usecs{}; //!< 今のゲームターンにおける区分ごとの所要時間の合計
+std::array<std::vector<double>, enum2i(TurnPhase::MAX)> phase_usecs; //!< 区分ごと・ゲームターンごとの所要時間
+bool is_reported = false;
+bool is_savefile_copied = false; //!< セーブファイルを計測用に複製したか
+
+/*!
+ * @brief 昇順に並べた標本からパーセンタイル値を求める (nearest-rank 法)
+ * @param sorted 昇順に並べた標本
+ * @param percent パーセント
+ * @return パーセンタイル値
+ */
+double percentile(const std::vector<double> &sorted, int percent)
+{
+    if (sorted.empty()) {
+        return 0.0;
+    }
+
+    auto rank = (sorted.size() * percent + 99) / 100;
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+/*!
+ * @brief 計測結果をJSONで書き出す
+ * @param fp 出力先
+ */
+void write_report(FILE *fp)
+{
+    const auto *floor_ptr = p_ptr->current_floor_ptr;
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"scenario\": \"%s\",\n", scenario.data());
+    fprintf(fp, "  \"turns\": %zu,\n", phase_usecs[enum2i(TurnPhase::TURN)].size());
+    if (floor_ptr != nullptr) {
+        fprintf(fp, "  \"floor\": { \"dungeon\": %d, \"level\": %d, \"wild_mode\": %s, \"monsters\": %d, \"objects\": %d },\n",
+            static_cast<int>(floor_ptr->dungeon_idx), static_cast<int>(floor_ptr->dun_level), p_ptr->wild_mode ? "true" : "false",
+            static_cast<int>(floor_ptr->m_cnt), static_cast<int>(floor_ptr->o_cnt));
+    }
+
+    fprintf(fp, "  \"phases\": {\n");
+    for (auto i = 0; i < enum2i(TurnPhase::MAX); i++) {
+        auto &samples = phase_usecs[i];
+        std::sort(samples.begin(), samples.end());
+        auto total = 0.0;
+        for (auto usec : samples) {
+            total += usec;
+        }
+
+        fprintf(fp, "    \"%s\": { \"total_usec\": %.1f, \"p50_usec\": %.2f, \"p90_usec\": %.2f, \"p99_usec\": %.2f, \"max_usec\": %.2f }%s\n",
+            TURN_PHASE_NAMES[i], total, percentile(samples, 50), percentile(samples, 90), percentile(samples, 99),
+            samples.empty() ? 0.0 : samples.back(), (i + 1 < enum2i(TurnPhase::MAX)) ? "," : "");
+    }
+
+    fprintf(fp, "  }\n");
+    fprintf(fp, "}\n");
+}
+
+/*!
+ * @brief 終了時に計測結果を書き出し、端末を解放する
+ * @param s 終了メッセージ (未使用)
+ * @details キャラクターの死亡などで計測ターン数に達する前に終わった場合も、そこまでの結果を書き出す
+ */
+void quit_hook(concptr s)
+{
+    (void)s;
+    if (!is_reported) {
+        is_reported = true;
+        set_turn_phase_observer(nullptr);
+        auto *fp = output_path.empty() ? stdout : angband_fopen(output_path.data(), "w");
+        if (fp != nullptr) {
+            write_report(fp);
+            if (fp != stdout) {
+                angband_fclose(fp);
+            }
+        }
+    }
+
+    /* 計測用に複製したセーブファイルと保存フロアのテンポラリファイルを片付ける */
+    if (is_savefile_copied) {
+        is_savefile_copied = false;
+        clear_saved_floor_files(p_ptr);
+        (void)fd_kill(savefile);
+        (void)fd_kill(std::string(savefile).append(".new").data());
+    }
+
+    for (auto j = 8 - 1; j >= 0; j--) {
+        if (angband_term[j]) {
+            term_nuke(angband_term[j]);
+        }
+    }
+}
+
+/*!
+ * @brief プレイヤーの周りへ増殖するモンスターを召喚する
+ * @details 最も浅い階層に出現する、ユニークでない増殖モンスターを選ぶ
+ */
+void summon_breeders()
+{
+    auto breeder = MonsterRace::empty_id();
+    for (const auto &[r_idx, r_ref] : r_info) {
+        if (!MonsterRace(r_idx).is_valid() || none_bits(r_ref.flags2, RF2_MULTIPLY) || r_ref.kind_flags.has(MonsterKindType::UNIQUE)) {
+            continue;
+        }
+
+        if (!MonsterRace(breeder).is_valid() || (r_ref.level < r_info[breeder].level)) {
+            breeder = r_idx;
+        }
+    }
+
+    if (!MonsterRace(breeder).is_valid()) {
+        return;
+    }
+
+    for (auto i = 0; i < breeder_count; i++) {
+        (void)summon_named_creature(p_ptr, 0, p_ptr->y, p_ptr->x, breeder, PM_NONE);
+    }
+}
+
+/*!
+ * @brief ゲームターン内の処理の所要時間を受け取る
+ * @param phase 処理の区分
+ * @param elapsed 所要時間
+ */
+void observe_turn_phase(TurnPhase phase, std::chrono::nanoseconds elapsed)
+{
+    current_turn_usecs[enum2i(phase)] += elapsed.count() / 1000.0;
+    if (phase != TurnPhase::TURN) {
+        return;
+    }
+
+    passed_turns++;
+    if (passed_turns == 1) {
+        /* 計測の途中で死亡して遺言の入力待ちにならないようにする */
+        cheat_immortal = true;
+
+        /* 計測中のセーブは不要な上に所要時間を乱すので止める */
+        autosave_t = false;
+        autosave_l = false;
+        autosave_freq = 0;
+        auto_debug_save = false;
+        if (jump_dungeon_idx > 0) {
+            if (jump_seed != 0) {
+                w_ptr->rng.set_state(jump_seed);
+            }
+
+            jump_floor(p_ptr, static_cast<DUNGEON_IDX>(jump_dungeon_idx), static_cast<DEPTH>(jump_level));
+            jump_dungeon_idx = 0;
+            passed_turns = 0;
+            current_turn_usecs.fill(0.0);
+            return;
+        }
+
+        summon_breeders();
+    }
+
+    if (passed_turns > warmup_turns) {
+        for (auto i = 0; i < enum2i(TurnPhase::MAX); i++) {
+            phase_usecs[i].push_back(current_turn_usecs[i]);
+        }
+    }
+
+    current_turn_usecs.fill(0.0);
+    if (passed_turns >= warmup_turns + measure_turns) {
+        quit(nullptr);
+    }
+}
+
+/*!
+ * @brief ファイルパスを初期化する
+ * @details main.cpp と同じく、環境変数 ANGBAND_PATH があればそれを、なければ既定のパスを使う
+ */
+void init_stuff()
+{
+    char libpath[1024], varpath[1024];
+    concptr tail = getenv("ANGBAND_PATH");
+    angband_strcpy(libpath, tail ? tail : DEFAULT_LIB_PATH, 511);
+    angband_strcpy(varpath, tail ? tail : DEFAULT_VAR_PATH, 511);
+    if (!suffix(libpath, PATH_SEP)) {
+        angband_strcat(libpath, PATH_SEP, sizeof(libpath));
+    }
+
+    if (!suffix(varpath, PATH_SEP)) {
+        angband_strcat(varpath, PATH_SEP, sizeof(varpath));
+    }
+
+    init_file_paths(libpath, varpath);
+}
+
+/*!
+ * @brief 使い方を表示して終了する
+ * @param program プログラム名
+ */
+void display_usage(concptr program)
+{
+    printf("Usage: %s -u<name> [options] [-- <headless sub options>]\n", program);
+    puts("  -u<name>   Savefile (character name) to load");
+    puts("  -n<turns>  Number of game turns to measure (default 1000)");
+    puts("  -w<turns>  Number of game turns to run before measuring (default 10)");
+    puts("  -d<dungeon>,<level>[,<seed>]  Move to a new floor of <dungeon> before measuring");
+    puts("  -b<count>  Summon <count> breeders around the player before measuring");
+    puts("  -s<label>  Scenario label written to the report");
+    puts("  -o<file>   Write the JSON report to <file> instead of stdout");
+    puts("  --         Sub options of the headless front end (see hengband -mheadless)");
+    quit(nullptr);
+}
+
+}
+
+/*!
+ * @brief ゲームターン計測のメイン関数
+ * @param argc 引数の数
+ * @param argv 引数
+ * @return 終了コード
+ */
+int main(int argc, char *argv[])
+{
+    argv0 = argv[0];
+    init_stuff();
+
+#ifdef SET_UID
+    p_ptr->player_uid = getuid();
+#endif
+
+    safe_setuid_drop();
+
+    auto has_name = false;
+    auto i = 1;
+    for (; i < argc; i++) {
+        const auto *arg = argv[i];
+        if (streq(arg, "--")) {
+            break;
+        }
+
+        if ((arg[0] != '-') || (arg[1] == '\0')) {
+            display_usage(argv[0]);
+        }
+
+        switch (arg[1]) {
+        case 'u':
+            angband_strcpy(p_ptr->name, &arg[2], sizeof(p_ptr->name));
+            has_name = p_ptr->name[0] != '\0';
+            break;
+        case 'n':
+            measure_turns = atoi(&arg[2]);
+            break;
+        case 'w':
+            warmup_turns = atoi(&arg[2]);
+            break;
+        case 'd':
+            if (sscanf(&arg[2], "%d,%d,%u", &jump_dungeon_idx, &jump_level, &jump_seed) < 2) {
+                display_usage(argv[0]);
+            }
+
+            break;
+        case 'b':
+            breeder_count = atoi(&arg[2]);
+            break;
+        case 's':
+            scenario = &arg[2];
+            break;
+        case 'o':
+            output_path = &arg[2];
+            break;
+        default:
+            display_usage(argv[0]);
+        }
+    }
+
+    if (!has_name || (measure_turns <= 0) || (warmup_turns < 0) || (jump_dungeon_idx < 0) || (jump_level < 0)) {
+        display_usage(argv[0]);
+    }
+
+    process_player_name(p_ptr, true);
+
+    /* 計測中にセーブが走っても元のセーブファイルを書き換えないよう、複製を読み込む */
+    const std::string original_savefile = savefile;
+    angband_strcat(savefile, ".benchmark", sizeof(savefile));
+    if (fd_copy(original_savefile.data(), savefile) != 0) {
+        quit_fmt("Failed to copy the savefile: %s", original_savefile.data());
+    }
+
+    is_savefile_copied = true;
+    quit_aux = quit_hook;
+    if (i < argc) {
+        argv[i] = argv[0];
+        (void)init_headless(argc - i, &argv[i]);
+    } else {
+        headless_push_keys("\\e,");
+        char repeat_opt[] = "-r";
+        char *headless_argv[] = { argv[0], repeat_opt };
+        (void)init_headless(2, headless_argv);
+    }
+
+    ANGBAND_SYS = "headless";
+    signals_init();
+    init_angband(p_ptr, false);
+    set_turn_phase_observer(observe_turn_phase);
+    play_game(p_ptr, false, false);
+    quit(nullptr);
+    return 0;
+}
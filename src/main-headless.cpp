@@ -0,0 +1,198 @@
+﻿/* File: main-headless.cpp */
+
+/*
+ * Copyright (c) 1997 Ben Harrison, and others
+ *
+ * This software may be copied and distributed for educational, research,
+ * and not for profit purposes provided that this copyright and statement
+ * are included in all such copies.
+ */
+
+/*!
+ * @brief 画面を持たないフロントエンド / Headless front end
+ * @details
+ * 描画要求は全て捨て、キー入力はあらかじめ与えたキースクリプトから1キーずつ供給する。
+ * 負荷試験・ベンチマーク・長時間試験を端末なしで大量に回すためのもの。
+ * <pre>
+ * hengband -mheadless -- [-k<keys>] [-f<file>] [-r]
+ *   -k<keys>  キースクリプト (マクロと同じ \e や ^X などの表記が使える)
+ *   -f<file>  キースクリプトをファイルから読む (改行は無視する)
+ *   -r        スクリプトを使い切ったら先頭から繰り返す (指定がなければ終了する)
+ * </pre>
+ */
+
+#include "main-headless.h"
+#include "system/angband.h"
+#include "term/gameterm.h"
+#include "term/term-color-types.h"
+#include "term/z-term.h"
+#include "term/z-util.h"
+#include "util/angband-files.h"
+#include "util/string-processor.h"
+#include <string>
+
+/*!
+ * @brief 画面なし端末の情報
+ */
+struct term_data {
+    term_type t;
+};
+
+static term_data data;
+
+static std::string key_script; //!< 供給するキーの列
+static size_t key_script_pos = 0; //!< 次に供給するキーの位置
+static bool repeat_key_script = false; //!< 使い切ったら先頭から繰り返すか
+
+/*!
+ * @brief キースクリプトの末尾にキーを追加する
+ * @param keys マクロと同じ表記のキー列
+ */
+void headless_push_keys(std::string_view keys)
+{
+    char buf[1024];
+    text_to_ascii(buf, keys, sizeof(buf));
+    key_script.append(buf);
+}
+
+/*!
+ * @brief キースクリプトをファイルから読み込む
+ * @param path ファイルパス
+ * @return 読み込めたならば0
+ */
+static errr load_key_script(concptr path)
+{
+    FILE *fp = angband_fopen(path, "r");
+    if (!fp) {
+        return -1;
+    }
+
+    char buf[1024];
+    while (angband_fgets(fp, buf, sizeof(buf)) == 0) {
+        headless_push_keys(buf);
+    }
+
+    angband_fclose(fp);
+    return 0;
+}
+
+/*!
+ * @brief キースクリプトから次のキーを1つ供給する
+ * @return キーを供給できたならば0
+ */
+static errr game_term_xtra_headless_event()
+{
+    if (key_script_pos >= key_script.size()) {
+        if (!repeat_key_script || key_script.empty()) {
+            quit("Headless key script exhausted.");
+        }
+
+        key_script_pos = 0;
+    }
+
+    return term_key_push(static_cast<unsigned char>(key_script[key_script_pos++]));
+}
+
+/*
+ * Handle a "special request"
+ */
+static errr game_term_xtra_headless(int n, int v)
+{
+    switch (n) {
+    case TERM_XTRA_EVENT:
+        if (v) {
+            return game_term_xtra_headless_event();
+        }
+
+        return 1;
+
+    case TERM_XTRA_CLEAR:
+    case TERM_XTRA_NOISE:
+    case TERM_XTRA_SOUND:
+    case TERM_XTRA_FRESH:
+    case TERM_XTRA_SHAPE:
+    case TERM_XTRA_ALIVE:
+    case TERM_XTRA_FLUSH:
+    case TERM_XTRA_DELAY:
+    case TERM_XTRA_REACT:
+        return 0;
+    }
+
+    /* Unknown */
+    return 1;
+}
+
+/*
+ * Nothing is drawn
+ */
+static errr game_term_curs_headless(TERM_LEN x, TERM_LEN y)
+{
+    (void)x;
+    (void)y;
+    return 0;
+}
+
+/*
+ * Nothing is drawn
+ */
+static errr game_term_wipe_headless(TERM_LEN x, TERM_LEN y, int n)
+{
+    (void)x;
+    (void)y;
+    (void)n;
+    return 0;
+}
+
+/*
+ * Nothing is drawn
+ */
+static errr game_term_text_headless(TERM_LEN x, TERM_LEN y, int n, TERM_COLOR a, concptr s)
+{
+    (void)x;
+    (void)y;
+    (void)n;
+    (void)a;
+    (void)s;
+    return 0;
+}
+
+/*!
+ * @brief 画面なしフロントエンドを初期化する
+ * @param argc サブオプションの数
+ * @param argv サブオプション
+ * @return 初期化できたならば0
+ */
+errr init_headless(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (prefix(argv[i], "-k")) {
+            headless_push_keys(&argv[i][2]);
+            continue;
+        }
+
+        if (prefix(argv[i], "-f")) {
+            if (load_key_script(&argv[i][2])) {
+                quit_fmt("Cannot open key script '%s'", &argv[i][2]);
+            }
+
+            continue;
+        }
+
+        if (prefix(argv[i], "-r")) {
+            repeat_key_script = true;
+        }
+    }
+
+    term_type *t = &data.t;
+    term_init(t, 80, 24, 256);
+    t->attr_blank = TERM_WHITE;
+    t->char_blank = ' ';
+    t->text_hook = game_term_text_headless;
+    t->wipe_hook = game_term_wipe_headless;
+    t->curs_hook = game_term_curs_headless;
+    t->xtra_hook = game_term_xtra_headless;
+    t->data = &data;
+    term_activate(t);
+    angband_term[0] = t;
+    return 0;
+}
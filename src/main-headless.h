@@ -0,0 +1,7 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include <string_view>
+
+errr init_headless(int argc, char *argv[]);
+void headless_push_keys(std::string_view keys);
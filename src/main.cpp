@@ -15,6 +15,7 @@
 #include "io/record-play-movie.h"
 #include "io/signal-handlers.h"
 #include "io/uid-checker.h"
+#include "main-headless.h"
 #include "main/angband-initializer.h"
 #include "player/process-name.h"
 #include "system/angband-version.h"
@@ -26,9 +27,11 @@
 #include "util/angband-files.h"
 #include "util/string-processor.h"
 #include "view/display-scores.h"
+#include "wizard/floor-generation-benchmark.h"
 #include "wizard/spoiler-util.h"
 #include "wizard/wizard-spoiler.h"
 #include <string>
+#include <string_view>
 
 /*
  * Available graphic modes
@@ -262,6 +265,8 @@ static void display_usage(const char *program)
     puts("  -d<def>  Define a 'lib' dir sub-path");
     puts("  --output-spoilers");
     puts("           Output auto generated spoilers and exit");
+    puts("  --benchmark-floors=<dungeon>,<level>,<count>[,<seed>]");
+    puts("           Generate <count> seeded floors, output timings and exit");
     puts("");
 
 #ifdef USE_X11
@@ -286,18 +291,54 @@ static void display_usage(const char *program)
     puts("  -mcap    To use CAP (\"Termcap\" calls)");
 #endif /* USE_CAP */
 
+    puts("  -mheadless To run without any display");
+    puts("  --       Sub options");
+    puts("  -- -k<keys> Key script to feed as input");
+    puts("  -- -f<file> Read the key script from <file>");
+    puts("  -- -r    Repeat the key script instead of quitting");
+
     /* Actually abort the process */
     quit(nullptr);
 }
 
+/*
+ * @brief フロア生成の計測を行い、終了する
+ * @param args "<dungeon>,<level>,<count>[,<seed>]" 形式の引数
+ * @return Usageを表示する必要があるか否か
+ */
+static bool benchmark_floors(const char *args)
+{
+    int dungeon_idx;
+    int dun_level;
+    int count;
+    unsigned int seed = 0;
+    if (sscanf(args, "%d,%d,%d,%u", &dungeon_idx, &dun_level, &count, &seed) < 3) {
+        return true;
+    }
+
+    init_stuff();
+    init_angband(p_ptr, true);
+    if (!output_floor_generation_benchmark(p_ptr, static_cast<DUNGEON_IDX>(dungeon_idx), static_cast<DEPTH>(dun_level), count, seed)) {
+        quit("Invalid floor benchmark parameters.");
+    }
+
+    quit(nullptr);
+    return false;
+}
+
 /*
  * @brief 2文字以上のコマンドライン引数 (オプション)を実行する
  * @param opt コマンドライン引数
  * @return Usageを表示する必要があるか否か
- * @details v3.0.0 Alpha21時点では、スポイラー出力モードの判定及び実行を行う
+ * @details スポイラー出力モードとフロア生成計測モードの判定及び実行を行う
  */
 static bool parse_long_opt(const char *opt)
 {
+    constexpr std::string_view benchmark_floors_opt = "benchmark-floors=";
+    if (std::string_view(opt + 2).substr(0, benchmark_floors_opt.size()) == benchmark_floors_opt) {
+        return benchmark_floors(opt + 2 + benchmark_floors_opt.size());
+    }
+
     if (strcmp(opt + 2, "output-spoilers") != 0) {
         return true;
     }
@@ -518,6 +559,14 @@ int main(int argc, char *argv[])
     /* Install "quit" hook */
     quit_aux = quit_hook;
 
+    /* Attempt to use the "main-headless.cpp" support (only when requested) */
+    if (!done && mstr && streq(mstr, "headless")) {
+        if (0 == init_headless(argc, argv)) {
+            ANGBAND_SYS = "headless";
+            done = true;
+        }
+    }
+
 #ifdef USE_X11
     /* Attempt to use the "main-x11.c" support */
     if (!done && (!mstr || (streq(mstr, "x11")))) {
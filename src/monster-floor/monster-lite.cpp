@@ -3,6 +3,7 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "floor/cave.h"
+#include "floor/floor-base-definitions.h"
 #include "grid/feature-flag-types.h"
 #include "grid/grid.h"
 #include "monster-floor/monster-lite-util.h"
@@ -17,13 +18,42 @@
 #include "system/monster-race-definition.h"
 #include "system/monster-type-definition.h"
 #include "system/player-type-definition.h"
+#include "util/bit-flags-calculator.h"
 #include "util/point-2d.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 #include <vector>
 
+namespace {
+
 /*!
- * @brief モンスターによる光量状態更新 / Add a square to the changes array
+ * @brief モンスター1体分の光源 (暗源)
+ * @details
+ * grids はこの光源だけで照らす (暗くする) マスの一覧であり、位置・半径・プレイヤーの位置・
+ * 視界の世代番号が前回と同じならば計算し直さない。
+ * マスごとの照明状態は光源ごとの寄与の重なり数から決め、変化したマスだけを描き直す。
+ */
+struct monster_lite_source {
+    POSITION fy = 0; //!< 光源のY座標
+    POSITION fx = 0; //!< 光源のX座標
+    POSITION py = 0; //!< 計算時のプレイヤーのY座標
+    POSITION px = 0; //!< 計算時のプレイヤーのX座標
+    int rad = 0; //!< 光源の半径 (負ならば暗源、0ならば光源なし)
+    bool invis = false; //!< 光源がプレイヤーの視界外にあるか
+    uint32_t sight_epoch = 0; //!< 計算時の視界・光源・地形の世代番号
+    std::vector<Pos2D> grids; //!< 照らしている (暗くしている) マス
+};
+
+std::vector<monster_lite_source> mon_lite_sources; //!< モンスターごとの光源 (添字はモンスターID)
+std::vector<uint16_t> mon_lite_refs(MAX_HGT * MAX_WID); //!< マスを照らしている光源の数
+std::vector<uint16_t> mon_dark_refs(MAX_HGT * MAX_WID); //!< マスを暗くしている暗源の数
+std::vector<uint32_t> mon_lite_stamps(MAX_HGT * MAX_WID); //!< マスを最後に更新対象へ加えた更新回
+uint32_t mon_lite_update_count = 0; //!< update_mon_lite() の呼び出し回数
+
+}
+
+/*!
+ * @brief モンスターの光源が照らせるマスならば記録する / Add a square to the changes array
  * @param player_ptr プレイヤーへの参照ポインタ
  * @param points 座標たちを記録する配列
  * @param y Y座標
@@ -36,7 +66,7 @@ static void update_monster_lite(
     int dpf, d;
     POSITION midpoint;
     g_ptr = &player_ptr->current_floor_ptr->grid_array[y][x];
-    if ((g_ptr->info & (CAVE_MNLT | CAVE_VIEW)) != CAVE_VIEW) {
+    if (none_bits(g_ptr->info, CAVE_VIEW)) {
         return;
     }
 
@@ -76,13 +106,7 @@ static void update_monster_lite(
         }
     }
 
-    if (!(g_ptr->info & CAVE_MNDK)) {
-        points.emplace_back(y, x);
-    } else {
-        g_ptr->info &= ~(CAVE_MNDK);
-    }
-
-    g_ptr->info |= CAVE_MNLT;
+    points.emplace_back(y, x);
 }
 
 /*
@@ -94,7 +118,7 @@ static void update_monster_dark(
     grid_type *g_ptr;
     int midpoint, dpf, d;
     g_ptr = &player_ptr->current_floor_ptr->grid_array[y][x];
-    if ((g_ptr->info & (CAVE_LITE | CAVE_MNLT | CAVE_MNDK | CAVE_VIEW)) != CAVE_VIEW) {
+    if ((g_ptr->info & (CAVE_LITE | CAVE_VIEW)) != CAVE_VIEW) {
         return;
     }
 
@@ -135,208 +159,264 @@ static void update_monster_dark(
     }
 
     points.emplace_back(y, x);
-    g_ptr->info |= CAVE_MNDK;
 }
 
 /*!
- * @brief Update squares illuminated or darkened by monsters.
- * The CAVE_TEMP and CAVE_XTRA flag are used to store the state during the
- * updating.  Only squares in view of the player, whos state
- * changes are drawn via lite_spot().
- * @todo player-status からのみ呼ばれている。しかしあちらは行数が酷いので要調整
+ * @brief モンスターの光源の半径を求める
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @param dis_lim 光源を考慮するプレイヤーからの距離の上限
+ * @return 光源の半径 (負ならば暗源、0ならば光源なし)
  */
-void update_mon_lite(PlayerType *player_ptr)
+static int calc_monster_lite_radius(PlayerType *player_ptr, monster_type *m_ptr, int dis_lim)
 {
-    // 座標たちを記録する配列。
-    std::vector<Pos2D> points;
-
-    void (*add_mon_lite)(PlayerType *, std::vector<Pos2D> &, const POSITION, const POSITION, const monster_lite_type *);
-    int dis_lim = (d_info[player_ptr->dungeon_idx].flags.has(DungeonFeatureType::DARKNESS) && !player_ptr->see_nocto) ? (MAX_SIGHT / 2 + 1) : (MAX_SIGHT + 3);
-    auto *floor_ptr = player_ptr->current_floor_ptr;
-    for (int i = 0; i < floor_ptr->mon_lite_n; i++) {
-        grid_type *g_ptr;
-        g_ptr = &floor_ptr->grid_array[floor_ptr->mon_lite_y[i]][floor_ptr->mon_lite_x[i]];
-        g_ptr->info |= (g_ptr->info & CAVE_MNLT) ? CAVE_TEMP : CAVE_XTRA;
-        g_ptr->info &= ~(CAVE_MNLT | CAVE_MNDK);
+    if (!monster_is_valid(m_ptr) || (m_ptr->cdis > dis_lim)) {
+        return 0;
     }
 
-    if (!w_ptr->timewalk_m_idx) {
-        monster_type *m_ptr;
-        monster_race *r_ptr;
-        for (int i = 1; i < floor_ptr->m_max; i++) {
-            m_ptr = &floor_ptr->m_list[i];
-            r_ptr = &r_info[m_ptr->r_idx];
-            if (!monster_is_valid(m_ptr) || (m_ptr->cdis > dis_lim)) {
-                continue;
-            }
+    auto *r_ptr = &r_info[m_ptr->r_idx];
+    int rad = 0;
+    if (r_ptr->flags7 & (RF7_HAS_LITE_1 | RF7_SELF_LITE_1)) {
+        rad++;
+    }
 
-            int rad = 0;
-            if (r_ptr->flags7 & (RF7_HAS_LITE_1 | RF7_SELF_LITE_1)) {
-                rad++;
-            }
+    if (r_ptr->flags7 & (RF7_HAS_LITE_2 | RF7_SELF_LITE_2)) {
+        rad += 2;
+    }
 
-            if (r_ptr->flags7 & (RF7_HAS_LITE_2 | RF7_SELF_LITE_2)) {
-                rad += 2;
-            }
+    if (r_ptr->flags7 & (RF7_HAS_DARK_1 | RF7_SELF_DARK_1)) {
+        rad--;
+    }
 
-            if (r_ptr->flags7 & (RF7_HAS_DARK_1 | RF7_SELF_DARK_1)) {
-                rad--;
-            }
+    if (r_ptr->flags7 & (RF7_HAS_DARK_2 | RF7_SELF_DARK_2)) {
+        rad -= 2;
+    }
 
-            if (r_ptr->flags7 & (RF7_HAS_DARK_2 | RF7_SELF_DARK_2)) {
-                rad -= 2;
-            }
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    if (rad > 0) {
+        if (!(r_ptr->flags7 & (RF7_SELF_LITE_1 | RF7_SELF_LITE_2)) && (monster_csleep_remaining(m_ptr) || (!floor_ptr->dun_level && is_daytime()) || player_ptr->phase_out)) {
+            return 0;
+        }
 
-            if (!rad) {
-                continue;
-            }
+        if (d_info[player_ptr->dungeon_idx].flags.has(DungeonFeatureType::DARKNESS)) {
+            return 1;
+        }
+    } else if (rad < 0) {
+        if (!(r_ptr->flags7 & (RF7_SELF_DARK_1 | RF7_SELF_DARK_2)) && (monster_csleep_remaining(m_ptr) || (!floor_ptr->dun_level && !is_daytime()))) {
+            return 0;
+        }
+    }
 
-            FloorFeatureType f_flag;
-            if (rad > 0) {
-                if (!(r_ptr->flags7 & (RF7_SELF_LITE_1 | RF7_SELF_LITE_2)) && (monster_csleep_remaining(m_ptr) || (!floor_ptr->dun_level && is_daytime()) || player_ptr->phase_out)) {
-                    continue;
-                }
+    return rad;
+}
 
-                if (d_info[player_ptr->dungeon_idx].flags.has(DungeonFeatureType::DARKNESS)) {
-                    rad = 1;
-                }
+/*!
+ * @brief 光源1つが照らす (暗くする) マスを求め直す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param source 光源
+ */
+static void calc_monster_lite_grids(PlayerType *player_ptr, monster_lite_source &source)
+{
+    auto &points = source.grids;
+    points.clear();
+    if (source.rad == 0) {
+        return;
+    }
 
-                add_mon_lite = update_monster_lite;
-                f_flag = FloorFeatureType::LOS;
-            } else {
-                if (!(r_ptr->flags7 & (RF7_SELF_DARK_1 | RF7_SELF_DARK_2)) && (monster_csleep_remaining(m_ptr) || (!floor_ptr->dun_level && !is_daytime()))) {
-                    continue;
-                }
+    void (*add_mon_lite)(PlayerType *, std::vector<Pos2D> &, const POSITION, const POSITION, const monster_lite_type *);
+    FloorFeatureType f_flag;
+    int rad;
+    if (source.rad > 0) {
+        add_mon_lite = update_monster_lite;
+        f_flag = FloorFeatureType::LOS;
+        rad = source.rad;
+    } else {
+        add_mon_lite = update_monster_dark;
+        f_flag = FloorFeatureType::PROJECT;
+        rad = -source.rad;
+    }
 
-                add_mon_lite = update_monster_dark;
-                f_flag = FloorFeatureType::PROJECT;
-                rad = -rad;
-            }
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    const monster_lite_type tmp_ml{ source.invis, source.fy, source.fx };
+    const auto *ml_ptr = &tmp_ml;
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 1, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 1, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 1, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 1, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 1, ml_ptr);
+    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 1, ml_ptr);
+    if (rad < 2) {
+        return;
+    }
 
-            monster_lite_type tmp_ml;
-            monster_lite_type *ml_ptr = initialize_monster_lite_type(floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].info, &tmp_ml, m_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 1, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 1, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 1, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 1, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 1, ml_ptr);
-            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 1, ml_ptr);
-            if (rad < 2) {
-                continue;
-            }
+    grid_type *g_ptr;
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx + 1, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx - 1, ml_ptr);
+        g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy + 2][ml_ptr->mon_fx];
+        if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx + 1, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx - 1, ml_ptr);
+        }
+    }
 
-            grid_type *g_ptr;
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx + 1, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx - 1, ml_ptr);
-                g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy + 2][ml_ptr->mon_fx];
-                if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx + 1, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 3, ml_ptr->mon_fx - 1, ml_ptr);
-                }
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx + 1, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx - 1, ml_ptr);
+        g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy - 2][ml_ptr->mon_fx];
+        if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx + 1, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx - 1, ml_ptr);
+        }
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx + 1, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx - 1, ml_ptr);
-                g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy - 2][ml_ptr->mon_fx];
-                if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx + 1, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 3, ml_ptr->mon_fx - 1, ml_ptr);
-                }
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy, ml_ptr->mon_fx + 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 2, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 2, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 2, ml_ptr);
+        g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy][ml_ptr->mon_fx + 2];
+        if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 3, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 3, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 3, ml_ptr);
+        }
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy, ml_ptr->mon_fx + 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 2, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 2, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 2, ml_ptr);
-                g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy][ml_ptr->mon_fx + 2];
-                if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 3, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx + 3, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 3, ml_ptr);
-                }
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy, ml_ptr->mon_fx - 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 2, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 2, ml_ptr);
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 2, ml_ptr);
+        g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy][ml_ptr->mon_fx - 2];
+        if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 3, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 3, ml_ptr);
+            add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 3, ml_ptr);
+        }
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy, ml_ptr->mon_fx - 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 2, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 2, ml_ptr);
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 2, ml_ptr);
-                g_ptr = &floor_ptr->grid_array[ml_ptr->mon_fy][ml_ptr->mon_fx - 2];
-                if ((rad == 3) && g_ptr->cave_has_flag(f_flag)) {
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 3, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy, ml_ptr->mon_fx - 3, ml_ptr);
-                    add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 3, ml_ptr);
-                }
-            }
+    if (rad != 3) {
+        return;
+    }
 
-            if (rad != 3) {
-                continue;
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx + 2, ml_ptr);
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx + 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx + 2, ml_ptr);
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx - 2, ml_ptr);
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy + 1, ml_ptr->mon_fx - 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy + 2, ml_ptr->mon_fx - 2, ml_ptr);
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx + 2, ml_ptr);
+    }
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx + 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx + 2, ml_ptr);
-            }
+    if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 1, f_flag)) {
+        add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx - 2, ml_ptr);
+    }
+}
 
-            if (cave_has_flag_bold(player_ptr->current_floor_ptr, ml_ptr->mon_fy - 1, ml_ptr->mon_fx - 1, f_flag)) {
-                add_mon_lite(player_ptr, points, ml_ptr->mon_fy - 2, ml_ptr->mon_fx - 2, ml_ptr);
-            }
-        }
+/*!
+ * @brief マスを今回の照明状態の見直し対象に加える
+ * @param touched 見直し対象のマス
+ * @param pos 座標
+ */
+static void touch_mon_lite_grid(std::vector<Pos2D> &touched, const Pos2D &pos)
+{
+    auto &stamp = mon_lite_stamps[pos.y * MAX_WID + pos.x];
+    if (stamp == mon_lite_update_count) {
+        return;
     }
 
-    const auto end_temp = size(points);
-    for (int i = 0; i < floor_ptr->mon_lite_n; i++) {
-        POSITION fx = floor_ptr->mon_lite_x[i];
-        POSITION fy = floor_ptr->mon_lite_y[i];
-        grid_type *g_ptr;
-        g_ptr = &floor_ptr->grid_array[fy][fx];
-        if (g_ptr->info & CAVE_TEMP) {
-            if ((g_ptr->info & (CAVE_VIEW | CAVE_MNLT)) == CAVE_VIEW) {
-                cave_note_and_redraw_later(floor_ptr, fy, fx);
-            }
-        } else if ((g_ptr->info & (CAVE_VIEW | CAVE_MNDK)) == CAVE_VIEW) {
-            cave_note_and_redraw_later(floor_ptr, fy, fx);
-        }
+    stamp = mon_lite_update_count;
+    touched.push_back(pos);
+}
 
-        points.emplace_back(fy, fx);
+/*!
+ * @brief 光源の寄与を重なり数に加える、または取り除く
+ * @param touched 見直し対象のマス
+ * @param source 光源
+ * @param count 加えるならば1、取り除くならば-1
+ */
+static void apply_monster_lite_source(std::vector<Pos2D> &touched, const monster_lite_source &source, int count)
+{
+    auto &refs = (source.rad > 0) ? mon_lite_refs : mon_dark_refs;
+    for (const auto &pos : source.grids) {
+        refs[pos.y * MAX_WID + pos.x] += static_cast<uint16_t>(count);
+        touch_mon_lite_grid(touched, pos);
     }
+}
 
-    floor_ptr->mon_lite_n = 0;
-    for (size_t i = 0; i < end_temp; i++) {
-        const auto [fy, fx] = points[i];
+/*!
+ * @brief Update squares illuminated or darkened by monsters.
+ * @details
+ * 光源ごとに照らすマスを覚えておき、位置や半径、視界が変わった光源だけを計算し直す。
+ * マスの照明状態は光源が1つでもあれば明るく、なければ暗源が1つでもあれば暗くなる。
+ * 状態が変わったマスのうちプレイヤーの視界内にあるものだけを描き直す。
+ * @todo player-status からのみ呼ばれている。しかしあちらは行数が酷いので要調整
+ */
+void update_mon_lite(PlayerType *player_ptr)
+{
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    int dis_lim = (d_info[player_ptr->dungeon_idx].flags.has(DungeonFeatureType::DARKNESS) && !player_ptr->see_nocto) ? (MAX_SIGHT / 2 + 1) : (MAX_SIGHT + 3);
+    if (mon_lite_sources.size() < floor_ptr->m_list.size()) {
+        mon_lite_sources.resize(floor_ptr->m_list.size());
+    }
 
-        grid_type *const g_ptr = &floor_ptr->grid_array[fy][fx];
-        if (g_ptr->info & CAVE_MNLT) {
-            if ((g_ptr->info & (CAVE_VIEW | CAVE_TEMP)) == CAVE_VIEW) {
-                cave_note_and_redraw_later(floor_ptr, fy, fx);
+    mon_lite_update_count++;
+    std::vector<Pos2D> touched;
+    for (size_t i = 1; i < mon_lite_sources.size(); i++) {
+        auto &source = mon_lite_sources[i];
+        auto rad = 0;
+        monster_lite_type tmp_ml{};
+        if (!w_ptr->timewalk_m_idx && (i < static_cast<size_t>(floor_ptr->m_max))) {
+            auto *m_ptr = &floor_ptr->m_list[i];
+            rad = calc_monster_lite_radius(player_ptr, m_ptr, dis_lim);
+            if (rad != 0) {
+                initialize_monster_lite_type(floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].info, &tmp_ml, m_ptr);
             }
-        } else if ((g_ptr->info & (CAVE_VIEW | CAVE_XTRA)) == CAVE_VIEW) {
-            cave_note_and_redraw_later(floor_ptr, fy, fx);
         }
 
-        floor_ptr->mon_lite_x[floor_ptr->mon_lite_n] = fx;
-        floor_ptr->mon_lite_y[floor_ptr->mon_lite_n] = fy;
-        floor_ptr->mon_lite_n++;
+        if ((rad == 0) && (source.rad == 0)) {
+            continue;
+        }
+
+        const auto is_same = (rad == source.rad) && (tmp_ml.mon_fy == source.fy) && (tmp_ml.mon_fx == source.fx) && (tmp_ml.mon_invis == source.invis) &&
+                             (player_ptr->y == source.py) && (player_ptr->x == source.px) && (floor_ptr->sight_epoch == source.sight_epoch);
+        if (is_same) {
+            continue;
+        }
+
+        apply_monster_lite_source(touched, source, -1);
+        source.rad = rad;
+        source.fy = tmp_ml.mon_fy;
+        source.fx = tmp_ml.mon_fx;
+        source.invis = tmp_ml.mon_invis;
+        source.py = player_ptr->y;
+        source.px = player_ptr->x;
+        source.sight_epoch = floor_ptr->sight_epoch;
+        calc_monster_lite_grids(player_ptr, source);
+        apply_monster_lite_source(touched, source, 1);
     }
 
-    for (size_t i = end_temp; i < size(points); i++) {
-        const auto [y, x] = points[i];
-        floor_ptr->grid_array[y][x].info &= ~(CAVE_TEMP | CAVE_XTRA);
+    for (const auto &[y, x] : touched) {
+        auto *g_ptr = &floor_ptr->grid_array[y][x];
+        const auto index = y * MAX_WID + x;
+        const BIT_FLAGS info = (mon_lite_refs[index] > 0) ? CAVE_MNLT : ((mon_dark_refs[index] > 0) ? CAVE_MNDK : 0);
+        if ((g_ptr->info & (CAVE_MNLT | CAVE_MNDK)) == info) {
+            continue;
+        }
+
+        g_ptr->info = (g_ptr->info & ~(CAVE_MNLT | CAVE_MNDK)) | info;
+        if (any_bits(g_ptr->info, CAVE_VIEW)) {
+            cave_note_and_redraw_later(floor_ptr, y, x);
+        }
     }
 
     player_ptr->update |= PU_DELAY_VIS;
@@ -367,11 +447,13 @@ void update_mon_lite(PlayerType *player_ptr)
  */
 void clear_mon_lite(floor_type *floor_ptr)
 {
-    for (int i = 0; i < floor_ptr->mon_lite_n; i++) {
-        grid_type *g_ptr;
-        g_ptr = &floor_ptr->grid_array[floor_ptr->mon_lite_y[i]][floor_ptr->mon_lite_x[i]];
-        g_ptr->info &= ~(CAVE_MNLT | CAVE_MNDK);
+    for (auto &source : mon_lite_sources) {
+        for (const auto &[y, x] : source.grids) {
+            floor_ptr->grid_array[y][x].info &= ~(CAVE_MNLT | CAVE_MNDK);
+            mon_lite_refs[y * MAX_WID + x] = 0;
+            mon_dark_refs[y * MAX_WID + x] = 0;
+        }
     }
 
-    floor_ptr->mon_lite_n = 0;
+    mon_lite_sources.clear();
 }
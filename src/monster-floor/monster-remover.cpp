@@ -97,6 +97,7 @@ void delete_monster_idx(PlayerType *player_ptr, MONSTER_IDX i)
 
     *m_ptr = {};
     floor_ptr->m_cnt--;
+    floor_ptr->m_list_epoch++;
     lite_spot(player_ptr, y, x);
     if (r_ptr->flags7 & (RF7_LITE_MASK | RF7_DARK_MASK)) {
         player_ptr->update |= (PU_MON_LITE);
@@ -154,6 +155,7 @@ void wipe_monsters_list(PlayerType *player_ptr)
 
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
+    floor_ptr->m_list_epoch++;
     for (int i = 0; i < MAX_MTIMED; i++) {
         floor_ptr->mproc_max[i] = 0;
     }
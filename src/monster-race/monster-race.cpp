@@ -10,7 +10,7 @@
 #include <vector>
 
 /* The monster race arrays */
-std::map<MonsterRaceId, monster_race> r_info;
+IndexedMap<MonsterRaceId, monster_race> r_info;
 
 MonsterRace::MonsterRace(MonsterRaceId r_idx)
     : r_idx(r_idx)
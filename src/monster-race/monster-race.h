@@ -1,12 +1,11 @@
 ﻿#pragma once
 
 #include "system/angband.h"
-
-#include <map>
+#include "util/indexed-map.h"
 
 enum class MonsterRaceId : int16_t;
 struct monster_race;
-extern std::map<MonsterRaceId, monster_race> r_info;
+extern IndexedMap<MonsterRaceId, monster_race> r_info;
 
 class MonsterRace {
 public:
@@ -44,6 +44,7 @@
 #include "util/probability-table.h"
 #include "view/display-messages.h"
 #include "world/world.h"
+#include <algorithm>
 #include <iterator>
 
 #define HORDE_NOGOOD 0x01 /*!< (未実装フラグ)HORDE生成でGOODなモンスターの生成を禁止する？ */
@@ -62,6 +63,7 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
         MONSTER_IDX i = floor_ptr->m_max;
         floor_ptr->m_max++;
         floor_ptr->m_cnt++;
+        floor_ptr->m_list_epoch++;
         return i;
     }
 
@@ -73,6 +75,7 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
             continue;
         }
         floor_ptr->m_cnt++;
+        floor_ptr->m_list_epoch++;
         return i;
     }
 
@@ -82,6 +85,104 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
     return 0;
 }
 
+/*!
+ * @brief 生きているモンスターの添字を昇順に並べた一覧を返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return 生きているモンスターの添字の一覧
+ * @details
+ * 空き番を読み飛ばすためのもの。モンスターの生成・削除・詰め直しがあった時 (m_list_epoch が進んだ時) だけ作り直す。
+ * 一覧をたどる間にモンスターが生成・削除されうる場合は、m_list_epoch が変わった時点で一覧を使うのをやめること。
+ */
+const std::vector<MONSTER_IDX> &get_live_monster_indices(floor_type *floor_ptr)
+{
+    static std::vector<MONSTER_IDX> live_monsters;
+    static uint32_t live_monsters_epoch = 0;
+    static bool is_built = false;
+    if (is_built && (live_monsters_epoch == floor_ptr->m_list_epoch)) {
+        return live_monsters;
+    }
+
+    live_monsters.clear();
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        if (MonsterRace(floor_ptr->m_list[i].r_idx).is_valid()) {
+            live_monsters.push_back(i);
+        }
+    }
+
+    live_monsters_epoch = floor_ptr->m_list_epoch;
+    is_built = true;
+    return live_monsters;
+}
+
+/*!
+ * @brief 指定した矩形の中にいるモンスターの添字を昇順に返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y1 矩形の上端のy座標
+ * @param x1 矩形の左端のx座標
+ * @param y2 矩形の下端のy座標
+ * @param x2 矩形の右端のx座標
+ * @return 該当するモンスターの添字の一覧
+ * @details
+ * 矩形の各マスの m_idx を調べるため、手間はフロア上のモンスターの総数でなく矩形の広さに比例する。
+ * 矩形のマス数が生きているモンスターの数より多い場合は、生きているモンスターの一覧をたどる方が安いのでそちらを使う。
+ */
+std::vector<MONSTER_IDX> get_monsters_in_rect(floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
+{
+    y1 = std::max<POSITION>(y1, 0);
+    x1 = std::max<POSITION>(x1, 0);
+    y2 = std::min<POSITION>(y2, floor_ptr->height - 1);
+    x2 = std::min<POSITION>(x2, floor_ptr->width - 1);
+    std::vector<MONSTER_IDX> monsters;
+    if ((y1 > y2) || (x1 > x2)) {
+        return monsters;
+    }
+
+    const auto area = (y2 - y1 + 1) * (x2 - x1 + 1);
+    if (area > floor_ptr->m_cnt) {
+        for (const auto m_idx : get_live_monster_indices(floor_ptr)) {
+            const auto &monster = floor_ptr->m_list[m_idx];
+            if (MonsterRace(monster.r_idx).is_valid() && (monster.fy >= y1) && (monster.fy <= y2) && (monster.fx >= x1) && (monster.fx <= x2)) {
+                monsters.push_back(m_idx);
+            }
+        }
+
+        return monsters;
+    }
+
+    for (auto y = y1; y <= y2; y++) {
+        for (auto x = x1; x <= x2; x++) {
+            const auto m_idx = floor_ptr->grid_array[y][x].m_idx;
+            if ((m_idx > 0) && MonsterRace(floor_ptr->m_list[m_idx].r_idx).is_valid()) {
+                monsters.push_back(m_idx);
+            }
+        }
+    }
+
+    std::sort(monsters.begin(), monsters.end());
+    return monsters;
+}
+
+/*!
+ * @brief 指定地点から一定距離以内にいるモンスターの添字を昇順に返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y 中心のy座標
+ * @param x 中心のx座標
+ * @param range 距離
+ * @return 該当するモンスターの添字の一覧
+ * @details 距離は縦横の差の大きい方を下回らないので、一辺 range * 2 + 1 の矩形から絞り込む
+ */
+std::vector<MONSTER_IDX> get_monsters_in_range(floor_type *floor_ptr, POSITION y, POSITION x, POSITION range)
+{
+    auto monsters = get_monsters_in_rect(floor_ptr, y - range, x - range, y + range, x + range);
+    const auto is_out_of_range = [floor_ptr, y, x, range](MONSTER_IDX m_idx) {
+        const auto &monster = floor_ptr->m_list[m_idx];
+        return distance(y, x, monster.fy, monster.fx) > range;
+    };
+
+    monsters.erase(std::remove_if(monsters.begin(), monsters.end(), is_out_of_range), monsters.end());
+    return monsters;
+}
+
 /*!
  * @brief 生成モンスター種族を1種生成テーブルから選択する
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "system/angband.h"
+#include <vector>
 
 #define GMN_ARENA 0x00000001 //!< 賭け闘技場向け生成
 
@@ -9,6 +10,9 @@ struct floor_type;
 struct monster_race;
 class PlayerType;
 MONSTER_IDX m_pop(floor_type *floor_ptr);
+const std::vector<MONSTER_IDX> &get_live_monster_indices(floor_type *floor_ptr);
+std::vector<MONSTER_IDX> get_monsters_in_rect(floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2);
+std::vector<MONSTER_IDX> get_monsters_in_range(floor_type *floor_ptr, POSITION y, POSITION x, POSITION range);
 
 MonsterRaceId get_mon_num(PlayerType *player_ptr, DEPTH min_level, DEPTH max_level, BIT_FLAGS option);
 void choose_new_monster(PlayerType *player_ptr, MONSTER_IDX m_idx, bool born, MonsterRaceId r_idx);
@@ -572,48 +572,81 @@ void process_monsters(PlayerType *player_ptr)
 }
 
 /*!
- * @brief フロア内のモンスターについてターン終了時の処理を繰り返す
+ * @brief モンスター1体についてターン終了時の処理を行う
  * @param player_ptr プレイヤーへの参照ポインタ
+ * @param i モンスターの添字
+ * @return 続けて他のモンスターを処理するならTRUE
  */
-void sweep_monster_process(PlayerType *player_ptr)
+static bool process_monster_turn(PlayerType *player_ptr, MONSTER_IDX i)
 {
-    auto *floor_ptr = player_ptr->current_floor_ptr;
-    for (MONSTER_IDX i = floor_ptr->m_max - 1; i >= 1; i--) {
-        monster_type *m_ptr;
-        m_ptr = &floor_ptr->m_list[i];
+    auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    if (!monster_is_valid(m_ptr)) {
+        return true;
+    }
 
-        if (player_ptr->leaving) {
-            return;
-        }
+    if (m_ptr->mflag.has(MonsterTemporaryFlagType::BORN)) {
+        m_ptr->mflag.reset(MonsterTemporaryFlagType::BORN);
+        return true;
+    }
 
-        if (!monster_is_valid(m_ptr) || player_ptr->wild_mode) {
-            continue;
-        }
+    if ((m_ptr->cdis >= AAF_LIMIT) || !decide_process_continue(player_ptr, m_ptr)) {
+        return true;
+    }
 
-        if (m_ptr->mflag.has(MonsterTemporaryFlagType::BORN)) {
-            m_ptr->mflag.reset(MonsterTemporaryFlagType::BORN);
-            continue;
-        }
+    byte speed = (player_ptr->riding == i) ? player_ptr->pspeed : decide_monster_speed(m_ptr);
+    m_ptr->energy_need -= speed_to_energy(speed);
+    if (m_ptr->energy_need > 0) {
+        return true;
+    }
 
-        if ((m_ptr->cdis >= AAF_LIMIT) || !decide_process_continue(player_ptr, m_ptr)) {
-            continue;
-        }
+    m_ptr->energy_need += ENERGY_NEED();
+    hack_m_idx = i;
+    process_monster(player_ptr, i);
+    reset_target(m_ptr);
+    if (player_ptr->no_flowed && one_in_(3)) {
+        m_ptr->mflag2.set(MonsterConstantFlagType::NOFLOW);
+    }
+
+    return player_ptr->playing && !player_ptr->is_dead && !player_ptr->leaving;
+}
+
+/*!
+ * @brief フロア内のモンスターについてターン終了時の処理を繰り返す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @details
+ * 空き番を読み飛ばすため、生きているモンスターの一覧を添字の降順にたどる。
+ * 処理中にモンスターが生成・削除された場合は一覧が実際と食い違うので、
+ * 残りは従来通り配列を直接たどり、処理の順番とエネルギーの増減を変えないようにする。
+ */
+void sweep_monster_process(PlayerType *player_ptr)
+{
+    if (player_ptr->leaving || player_ptr->wild_mode) {
+        return;
+    }
 
-        byte speed = (player_ptr->riding == i) ? player_ptr->pspeed : decide_monster_speed(m_ptr);
-        m_ptr->energy_need -= speed_to_energy(speed);
-        if (m_ptr->energy_need > 0) {
-            continue;
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    const auto &live_monsters = get_live_monster_indices(floor_ptr);
+    const auto epoch = floor_ptr->m_list_epoch;
+    auto next_m_idx = floor_ptr->m_max - 1;
+    for (auto n = live_monsters.size(); n > 0; n--) {
+        if (floor_ptr->m_list_epoch != epoch) {
+            break;
         }
 
-        m_ptr->energy_need += ENERGY_NEED();
-        hack_m_idx = i;
-        process_monster(player_ptr, i);
-        reset_target(m_ptr);
-        if (player_ptr->no_flowed && one_in_(3)) {
-            m_ptr->mflag2.set(MonsterConstantFlagType::NOFLOW);
+        const auto m_idx = live_monsters[n - 1];
+        if (!process_monster_turn(player_ptr, m_idx)) {
+            return;
         }
 
-        if (!player_ptr->playing || player_ptr->is_dead || player_ptr->leaving) {
+        next_m_idx = m_idx - 1;
+    }
+
+    if (floor_ptr->m_list_epoch == epoch) {
+        return;
+    }
+
+    for (MONSTER_IDX i = next_m_idx; i >= 1; i--) {
+        if (!process_monster_turn(player_ptr, i)) {
             return;
         }
     }
@@ -23,7 +23,7 @@
 /*
  * The ego-item arrays
  */
-std::map<EgoType, ego_item_type> e_info;
+IndexedMap<EgoType, ego_item_type> e_info;
 
 /*!
  * @brief アイテムのエゴをレア度の重みに合わせてランダムに選択する
@@ -1,6 +1,5 @@
 ﻿#pragma once
 
-#include <map>
 #include <string>
 #include <vector>
 
@@ -10,6 +9,7 @@
 #include "object-enchant/trg-types.h"
 #include "system/angband.h"
 #include "util/flag-group.h"
+#include "util/indexed-map.h"
 
 enum class EgoType {
     NONE = 0,
@@ -270,7 +270,7 @@ struct ego_item_type {
     RandomArtActType act_idx{}; //!< 発動番号 / Activative ability index
 };
 
-extern std::map<EgoType, ego_item_type> e_info;
+extern IndexedMap<EgoType, ego_item_type> e_info;
 
 class ObjectType;
 class PlayerType;
@@ -34,6 +34,7 @@ void object_known(ObjectType *o_ptr)
     o_ptr->ident &= ~(IDENT_SENSE);
     o_ptr->ident &= ~(IDENT_EMPTY);
     o_ptr->ident |= (IDENT_KNOWN);
+    invalidate_object_descriptions();
 }
 
 /*!
@@ -47,6 +48,7 @@ void object_aware(PlayerType *player_ptr, const ObjectType *o_ptr)
     const bool is_already_awared = o_ptr->is_aware();
 
     k_info[o_ptr->k_idx].aware = true;
+    invalidate_object_descriptions();
 
     // 以下、playrecordに記録しない場合はreturnする
     if (!record_ident) {
@@ -89,4 +91,5 @@ void object_aware(PlayerType *player_ptr, const ObjectType *o_ptr)
 void object_tried(const ObjectType *o_ptr)
 {
     k_info[o_ptr->k_idx].tried = true;
+    invalidate_object_descriptions();
 }
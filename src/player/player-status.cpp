@@ -10,6 +10,7 @@
 #include "combat/attack-power-table.h"
 #include "core/asking-player.h"
 #include "core/player-redraw-types.h"
+#include "core/player-update-profiler.h"
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
 #include "core/window-redrawer.h"
@@ -119,6 +120,7 @@
 #include "util/string-processor.h"
 #include "view/display-messages.h"
 #include "world/world.h"
+#include <array>
 
 static const int extra_magic_glove_reduce_mana = 1;
 
@@ -2625,9 +2627,60 @@ WEIGHT calc_weight_limit(PlayerType *player_ptr)
     return i;
 }
 
+/*!
+ * @brief update のフラグ1つ分の更新処理
+ * @details
+ * 表の並びがそのまま実行順であり、依存する処理ほど前に置く。
+ * satisfies は「この処理を実行すれば後続の処理も済んだことになる」関係、
+ * invalidates は「この処理を実行したら先行処理による satisfies が成り立たなくなる」関係を表す。
+ */
+struct player_update_pass {
+    UpdatePassType type; //!< 計測上の種別
+    BIT_FLAGS flag; //!< 実行を要求する update のフラグ
+    BIT_FLAGS satisfies; //!< この処理で代替できる後続の処理
+    BIT_FLAGS invalidates; //!< 代替を無効にする後続の処理
+    bool needs_floor; //!< フロア生成済かつ画面退避中でない時のみ実行するか
+    void (*process)(PlayerType *player_ptr); //!< 更新処理
+};
+
+/*!
+ * @brief update のフラグに応じた更新処理の一覧
+ * @details
+ * PU_DISTANCE は全モンスターを距離込みで更新するため、
+ * その後にモンスターの光源や視界の再描画が行われない限り PU_MONSTERS を兼ねる。
+ */
+static const std::array<player_update_pass, 17> PLAYER_UPDATE_PASSES = { {
+    { UpdatePassType::AUTODESTROY, PU_AUTODESTROY, 0, 0, false, [](PlayerType *player_ptr) { autopick_delayed_alter(player_ptr); } },
+    { UpdatePassType::COMBINE, PU_COMBINE, 0, 0, false, [](PlayerType *player_ptr) { combine_pack(player_ptr); } },
+    { UpdatePassType::REORDER, PU_REORDER, 0, 0, false, [](PlayerType *player_ptr) { reorder_pack(player_ptr); } },
+    { UpdatePassType::BONUS, PU_BONUS, 0, 0, false,
+        [](PlayerType *player_ptr) {
+            PlayerAlignment(player_ptr).update_alignment();
+            PlayerSkill ps(player_ptr);
+            ps.apply_special_weapon_skill_max_values();
+            ps.limit_weapon_skills_by_max_value();
+            update_bonuses(player_ptr);
+        } },
+    { UpdatePassType::TORCH, PU_TORCH, 0, 0, false, update_lite_radius },
+    { UpdatePassType::HP, PU_HP, 0, 0, false, update_max_hitpoints },
+    { UpdatePassType::MANA, PU_MANA, 0, 0, false, update_max_mana },
+    { UpdatePassType::SPELLS, PU_SPELLS, 0, 0, false, update_num_of_spells },
+    { UpdatePassType::UN_LITE, PU_UN_LITE, 0, 0, true, [](PlayerType *player_ptr) { forget_lite(player_ptr->current_floor_ptr); } },
+    { UpdatePassType::UN_VIEW, PU_UN_VIEW, 0, 0, true, [](PlayerType *player_ptr) { forget_view(player_ptr->current_floor_ptr); } },
+    { UpdatePassType::VIEW, PU_VIEW, 0, 0, true, update_view },
+    { UpdatePassType::LITE, PU_LITE, 0, 0, true, update_lite },
+    { UpdatePassType::FLOW, PU_FLOW, 0, 0, true, update_flow },
+    { UpdatePassType::DISTANCE, PU_DISTANCE, PU_MONSTERS, 0, true, [](PlayerType *player_ptr) { update_monsters(player_ptr, true); } },
+    { UpdatePassType::MON_LITE, PU_MON_LITE, 0, PU_MONSTERS, true, update_mon_lite },
+    { UpdatePassType::DELAY_VIS, PU_DELAY_VIS, 0, PU_MONSTERS, true, delayed_visual_update },
+    { UpdatePassType::MONSTERS, PU_MONSTERS, 0, 0, true, [](PlayerType *player_ptr) { update_monsters(player_ptr, false); } },
+} };
+
 /*!
  * @brief update のフラグに応じた更新をまとめて行う / Handle "update"
- * @details 更新処理の対象はプレイヤーの能力修正/光源寿命/HP/MP/魔法の学習状態、他多数の外界の状態判定。
+ * @details
+ * 更新処理の対象はプレイヤーの能力修正/光源寿命/HP/MP/魔法の学習状態、他多数の外界の状態判定。
+ * 先行する処理で既に済んだ処理は実行せず、実行回数と所要時間を PlayerUpdateProfiler に記録する。
  */
 void update_creature(PlayerType *player_ptr)
 {
@@ -2635,101 +2688,27 @@ void update_creature(PlayerType *player_ptr)
         return;
     }
 
-    auto *floor_ptr = player_ptr->current_floor_ptr;
-    if (any_bits(player_ptr->update, (PU_AUTODESTROY))) {
-        reset_bits(player_ptr->update, PU_AUTODESTROY);
-        autopick_delayed_alter(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_COMBINE))) {
-        reset_bits(player_ptr->update, PU_COMBINE);
-        combine_pack(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_REORDER))) {
-        reset_bits(player_ptr->update, PU_REORDER);
-        reorder_pack(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_BONUS))) {
-        reset_bits(player_ptr->update, PU_BONUS);
-        PlayerAlignment(player_ptr).update_alignment();
-        PlayerSkill ps(player_ptr);
-        ps.apply_special_weapon_skill_max_values();
-        ps.limit_weapon_skills_by_max_value();
-        update_bonuses(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_TORCH))) {
-        reset_bits(player_ptr->update, PU_TORCH);
-        update_lite_radius(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_HP))) {
-        reset_bits(player_ptr->update, PU_HP);
-        update_max_hitpoints(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_MANA))) {
-        reset_bits(player_ptr->update, PU_MANA);
-        update_max_mana(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_SPELLS))) {
-        reset_bits(player_ptr->update, PU_SPELLS);
-        update_num_of_spells(player_ptr);
-    }
-
-    if (!w_ptr->character_generated) {
-        return;
-    }
-    if (w_ptr->character_icky_depth > 0) {
-        return;
-    }
-    if (any_bits(player_ptr->update, (PU_UN_LITE))) {
-        reset_bits(player_ptr->update, PU_UN_LITE);
-        forget_lite(floor_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_UN_VIEW))) {
-        reset_bits(player_ptr->update, PU_UN_VIEW);
-        forget_view(floor_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_VIEW))) {
-        reset_bits(player_ptr->update, PU_VIEW);
-        update_view(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_LITE))) {
-        reset_bits(player_ptr->update, PU_LITE);
-        update_lite(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_FLOW))) {
-        reset_bits(player_ptr->update, PU_FLOW);
-        update_flow(player_ptr);
-    }
-
-    if (any_bits(player_ptr->update, (PU_DISTANCE))) {
-        reset_bits(player_ptr->update, PU_DISTANCE);
-
-        update_monsters(player_ptr, true);
-    }
+    auto &profiler = PlayerUpdateProfiler::get_instance();
+    BIT_FLAGS satisfied = 0;
+    for (const auto &pass : PLAYER_UPDATE_PASSES) {
+        if (pass.needs_floor && (!w_ptr->character_generated || (w_ptr->character_icky_depth > 0))) {
+            return;
+        }
 
-    if (any_bits(player_ptr->update, (PU_MON_LITE))) {
-        reset_bits(player_ptr->update, PU_MON_LITE);
-        update_mon_lite(player_ptr);
-    }
+        if (none_bits(player_ptr->update, pass.flag)) {
+            continue;
+        }
 
-    if (any_bits(player_ptr->update, (PU_DELAY_VIS))) {
-        reset_bits(player_ptr->update, PU_DELAY_VIS);
-        delayed_visual_update(player_ptr);
-    }
+        reset_bits(player_ptr->update, pass.flag);
+        if (any_bits(satisfied, pass.flag)) {
+            profiler.record_coalesced(pass.type);
+            continue;
+        }
 
-    if (any_bits(player_ptr->update, (PU_MONSTERS))) {
-        reset_bits(player_ptr->update, PU_MONSTERS);
-        update_monsters(player_ptr, false);
+        const auto pending = player_ptr->update;
+        profile_update_pass(pass.type, [player_ptr, &pass] { pass.process(player_ptr); });
+        set_bits(satisfied, pass.satisfies);
+        reset_bits(satisfied, pass.invalidates | (player_ptr->update & ~pending));
     }
 }
 
@@ -10,6 +10,24 @@
 #include "util/point-2d.h"
 #include <vector>
 
+namespace {
+
+/*!
+ * @brief 前回視界を計算した時の条件
+ * @details 全て同じならば視界も前回と同じになるため、計算を省略できる
+ */
+struct view_condition {
+    const floor_type *floor_ptr = nullptr; //!< 計算したフロア
+    POSITION y = 0; //!< プレイヤーのY座標
+    POSITION x = 0; //!< プレイヤーのX座標
+    int full = 0; //!< 視界の半径
+    uint32_t terrain_epoch = 0; //!< 地形の世代番号
+};
+
+view_condition last_view_condition;
+
+}
+
 /*
  * Helper function for "update_view()" below
  *
@@ -97,11 +115,15 @@ static bool update_view_aux(PlayerType *player_ptr, POSITION y, POSITION x, POSI
  *  4c: Process both "sides" of each "direction" of each strip
  *  4c1: Each side aborts as soon as possible
  *  4c2: Each side tells the next strip how far it has to check
+ *
+ * プレイヤーの位置・視界の半径・地形が前回の計算時から変わっておらず、
+ * 視界が消去されてもいなければ、視界は前回と同じであるため何もしない。
  */
 void update_view(PlayerType *player_ptr)
 {
     // 前回プレイヤーから見えていた座標たちを格納する配列。
-    std::vector<Pos2D> points;
+    static std::vector<Pos2D> points;
+    points.clear();
 
     int n, m, d, k, z;
     POSITION y, x;
@@ -123,6 +145,14 @@ void update_view(PlayerType *player_ptr)
         over = MAX_SIGHT * 3 / 2;
     }
 
+    const view_condition condition{ floor_ptr, player_ptr->y, player_ptr->x, full, floor_ptr->terrain_epoch };
+    const auto &last = last_view_condition;
+    if ((floor_ptr->view_n > 0) && (last.floor_ptr == condition.floor_ptr) && (last.y == condition.y) && (last.x == condition.x) && (last.full == condition.full) && (last.terrain_epoch == condition.terrain_epoch)) {
+        return;
+    }
+
+    last_view_condition = condition;
+    floor_ptr->sight_epoch++;
     for (n = 0; n < floor_ptr->view_n; n++) {
         y = floor_ptr->view_y[n];
         x = floor_ptr->view_x[n];
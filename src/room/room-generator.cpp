@@ -20,6 +20,8 @@
 #include "util/probability-table.h"
 #include "wizard/wizard-messages.h"
 
+static RoomBuildObserver room_build_observer;
+
 /*!
  * @brief 与えられた部屋型IDに応じて部屋の生成処理分岐を行い結果を返す / Attempt to build a room of the given type at the given block
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -69,6 +71,34 @@ static bool room_build(PlayerType *player_ptr, dun_data_type *dd_ptr, RoomType t
     }
 }
 
+/*!
+ * @brief 部屋を生成し、計測用フックが登録されていれば所要時間を通知する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param dd_ptr ダンジョン生成データへの参照ポインタ
+ * @param typ 部屋型ID
+ * @return 部屋の生成に成功した場合 TRUE を返す。
+ */
+static bool room_build_observed(PlayerType *player_ptr, dun_data_type *dd_ptr, RoomType typ)
+{
+    if (!room_build_observer) {
+        return room_build(player_ptr, dd_ptr, typ);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto is_built = room_build(player_ptr, dd_ptr, typ);
+    room_build_observer(typ, is_built, std::chrono::steady_clock::now() - start);
+    return is_built;
+}
+
+/*!
+ * @brief 部屋生成の計測用フックを登録する
+ * @param observer 計測用フック (空の関数オブジェクトを渡すと解除)
+ */
+void set_room_build_observer(RoomBuildObserver observer)
+{
+    room_build_observer = std::move(observer);
+}
+
 /*!
  * @brief 指定した部屋の生成確率を別の部屋に加算し、指定した部屋の生成率を0にする
  * @param dst 確率を移す先の部屋種ID
@@ -193,7 +223,7 @@ bool generate_rooms(PlayerType *player_ptr, dun_data_type *dd_ptr)
             }
 
             room_num[room_type]--;
-            if (!room_build(player_ptr, dd_ptr, room_type)) {
+            if (!room_build_observed(player_ptr, dd_ptr, room_type)) {
                 continue;
             }
 
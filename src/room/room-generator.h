@@ -1,5 +1,16 @@
 ﻿#pragma once
 
+#include "room/room-types.h"
+#include <chrono>
+#include <functional>
+
+/*!
+ * @brief 部屋1つの生成を試みるたびに呼ばれる計測用フック
+ * @details 引数は部屋型ID、生成に成功したか否か、所要時間
+ */
+using RoomBuildObserver = std::function<void(RoomType, bool, std::chrono::nanoseconds)>;
+
 struct dun_data_type;
 class PlayerType;
 bool generate_rooms(PlayerType *player_ptr, dun_data_type *dun_data);
+void set_room_build_observer(RoomBuildObserver observer);
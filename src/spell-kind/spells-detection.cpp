@@ -14,6 +14,7 @@
 #include "monster-race/race-flags3.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
+#include "monster/monster-list.h"
 #include "monster/monster-status.h"
 #include "monster/monster-update.h"
 #include "object/object-mark-types.h"
@@ -28,6 +29,7 @@
 #include "system/player-type-definition.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include "world/world-object.h"
 
 /*!
  * @brief プレイヤー周辺の地形を感知する
@@ -182,23 +184,11 @@ bool detect_objects_gold(PlayerType *player_ptr, POSITION range)
 
     /* Scan objects */
     bool detect = false;
-    POSITION y, x;
-    for (OBJECT_IDX i = 1; i < player_ptr->current_floor_ptr->o_max; i++) {
-        auto *o_ptr = &player_ptr->current_floor_ptr->o_list[i];
-
-        if (!o_ptr->is_valid()) {
-            continue;
-        }
-        if (o_ptr->is_held_by_monster()) {
-            continue;
-        }
-
-        y = o_ptr->iy;
-        x = o_ptr->ix;
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range2) {
-            continue;
-        }
-
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_floor_objects_in_range(floor_ptr, player_ptr->y, player_ptr->x, range2)) {
+        auto *o_ptr = &floor_ptr->o_list[i];
+        const auto y = o_ptr->iy;
+        const auto x = o_ptr->ix;
         if (o_ptr->tval == ItemKindType::GOLD) {
             o_ptr->marked |= OM_FOUND;
             lite_spot(player_ptr, y, x);
@@ -234,23 +224,11 @@ bool detect_objects_normal(PlayerType *player_ptr, POSITION range)
     }
 
     bool detect = false;
-    for (OBJECT_IDX i = 1; i < player_ptr->current_floor_ptr->o_max; i++) {
-        auto *o_ptr = &player_ptr->current_floor_ptr->o_list[i];
-
-        if (!o_ptr->is_valid()) {
-            continue;
-        }
-        if (o_ptr->is_held_by_monster()) {
-            continue;
-        }
-
-        POSITION y = o_ptr->iy;
-        POSITION x = o_ptr->ix;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range2) {
-            continue;
-        }
-
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_floor_objects_in_range(floor_ptr, player_ptr->y, player_ptr->x, range2)) {
+        auto *o_ptr = &floor_ptr->o_list[i];
+        const auto y = o_ptr->iy;
+        const auto x = o_ptr->ix;
         if (o_ptr->tval != ItemKindType::GOLD) {
             o_ptr->marked |= OM_FOUND;
             lite_spot(player_ptr, y, x);
@@ -294,23 +272,11 @@ bool detect_objects_magic(PlayerType *player_ptr, POSITION range)
 
     ItemKindType tv;
     bool detect = false;
-    for (OBJECT_IDX i = 1; i < player_ptr->current_floor_ptr->o_max; i++) {
-        auto *o_ptr = &player_ptr->current_floor_ptr->o_list[i];
-
-        if (!o_ptr->is_valid()) {
-            continue;
-        }
-        if (o_ptr->is_held_by_monster()) {
-            continue;
-        }
-
-        POSITION y = o_ptr->iy;
-        POSITION x = o_ptr->ix;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
-
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_floor_objects_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *o_ptr = &floor_ptr->o_list[i];
+        const auto y = o_ptr->iy;
+        const auto x = o_ptr->ix;
         tv = o_ptr->tval;
         if (o_ptr->is_artifact() || o_ptr->is_ego() || (tv == ItemKindType::WHISTLE) || (tv == ItemKindType::AMULET) || (tv == ItemKindType::RING) || (tv == ItemKindType::STAFF) || (tv == ItemKindType::WAND) || (tv == ItemKindType::ROD) || (tv == ItemKindType::SCROLL) || (tv == ItemKindType::POTION) || (tv == ItemKindType::LIFE_BOOK) || (tv == ItemKindType::SORCERY_BOOK) || (tv == ItemKindType::NATURE_BOOK) || (tv == ItemKindType::CHAOS_BOOK) || (tv == ItemKindType::DEATH_BOOK) || (tv == ItemKindType::TRUMP_BOOK) || (tv == ItemKindType::ARCANE_BOOK) || (tv == ItemKindType::CRAFT_BOOK) || (tv == ItemKindType::DEMON_BOOK) || (tv == ItemKindType::CRUSADE_BOOK) || (tv == ItemKindType::MUSIC_BOOK) || (tv == ItemKindType::HISSATSU_BOOK) || (tv == ItemKindType::HEX_BOOK) || ((o_ptr->to_a > 0) || (o_ptr->to_h + o_ptr->to_d > 0))) {
             o_ptr->marked |= OM_FOUND;
@@ -339,18 +305,10 @@ bool detect_monsters_normal(PlayerType *player_ptr, POSITION range)
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         auto *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
 
         if (!(r_ptr->flags2 & RF2_INVISIBLE) || player_ptr->see_inv) {
             m_ptr->mflag2.set({ MonsterConstantFlagType::MARK, MonsterConstantFlagType::SHOW });
@@ -382,21 +340,11 @@ bool detect_monsters_invis(PlayerType *player_ptr, POSITION range)
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         auto *r_ptr = &r_info[m_ptr->r_idx];
 
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
-
         if (r_ptr->flags2 & RF2_INVISIBLE) {
             if (player_ptr->monster_race_idx == m_ptr->r_idx) {
                 player_ptr->window_flags |= (PW_MONSTER);
@@ -431,19 +379,10 @@ bool detect_monsters_evil(PlayerType *player_ptr, POSITION range)
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         auto *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
 
         if (r_ptr->kind_flags.has(MonsterKindType::EVIL)) {
             if (is_original_ap(m_ptr)) {
@@ -479,18 +418,9 @@ bool detect_monsters_nonliving(PlayerType *player_ptr, POSITION range)
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
-
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         if (!monster_living(m_ptr->r_idx)) {
             if (player_ptr->monster_race_idx == m_ptr->r_idx) {
                 player_ptr->window_flags |= (PW_MONSTER);
@@ -522,19 +452,10 @@ bool detect_monsters_mind(PlayerType *player_ptr, POSITION range)
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         auto *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
 
         if (!(r_ptr->flags2 & RF2_EMPTY_MIND)) {
             if (player_ptr->monster_race_idx == m_ptr->r_idx) {
@@ -568,19 +489,10 @@ bool detect_monsters_string(PlayerType *player_ptr, POSITION range, concptr Matc
     }
 
     bool flag = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    for (const auto i : get_monsters_in_range(floor_ptr, player_ptr->y, player_ptr->x, range)) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         auto *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(player_ptr->y, player_ptr->x, y, x) > range) {
-            continue;
-        }
 
         if (angband_strchr(Match, r_ptr->d_char)) {
             if (player_ptr->monster_race_idx == m_ptr->r_idx) {
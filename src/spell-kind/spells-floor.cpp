@@ -408,6 +408,7 @@ bool destroy_area(PlayerType *player_ptr, POSITION y1, POSITION x1, POSITION r,
         }
     }
 
+    floor_ptr->terrain_epoch++;
     if (in_generate) {
         return true;
     }
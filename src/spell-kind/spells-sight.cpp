@@ -21,6 +21,7 @@
 #include "monster/monster-description-types.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
+#include "monster/monster-list.h"
 #include "monster/monster-status-setter.h"
 #include "monster/monster-status.h"
 #include "monster/smart-learn-types.h"
@@ -31,6 +32,7 @@
 #include "target/projection-path-calculator.h"
 #include "term/screen-processor.h"
 #include "view/display-messages.h"
+#include <vector>
 
 /*!
  * @brief 視界内モンスターに魔法効果を与える / Apply a "project()" directly to all viewable monsters
@@ -47,12 +49,17 @@
  */
 bool project_all_los(PlayerType *player_ptr, AttributeType typ, int dam)
 {
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
-        if (!monster_is_valid(m_ptr)) {
-            continue;
-        }
-
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    std::vector<MONSTER_IDX> targets;
+
+    /* 視界に入るマスはプレイヤーから縦横とも MAX_SIGHT 以内に収まる (闘技場の観戦中は全てのモンスターが対象) */
+    const auto y1 = player_ptr->y - MAX_SIGHT;
+    const auto x1 = player_ptr->x - MAX_SIGHT;
+    const auto y2 = player_ptr->y + MAX_SIGHT;
+    const auto x2 = player_ptr->x + MAX_SIGHT;
+    const auto candidates = player_ptr->phase_out ? get_live_monster_indices(floor_ptr) : get_monsters_in_rect(floor_ptr, y1, x1, y2, x2);
+    for (const auto i : candidates) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         POSITION y = m_ptr->fy;
         POSITION x = m_ptr->fx;
         if (!player_has_los_bold(player_ptr, y, x) || !projectable(player_ptr, player_ptr->y, player_ptr->x, y, x)) {
@@ -60,12 +67,13 @@ bool project_all_los(PlayerType *player_ptr, AttributeType typ, int dam)
         }
 
         m_ptr->mflag.set(MonsterTemporaryFlagType::LOS);
+        targets.push_back(i);
     }
 
     BIT_FLAGS flg = PROJECT_JUMP | PROJECT_KILL | PROJECT_HIDE;
     bool obvious = false;
-    for (MONSTER_IDX i = 1; i < player_ptr->current_floor_ptr->m_max; i++) {
-        auto *m_ptr = &player_ptr->current_floor_ptr->m_list[i];
+    for (const auto i : targets) {
+        auto *m_ptr = &floor_ptr->m_list[i];
         if (m_ptr->mflag.has_not(MonsterTemporaryFlagType::LOS)) {
             continue;
         }
@@ -1,23 +1,17 @@
 ﻿#include "store/black-market.h"
 #include "floor/floor-town.h"
+#include "object/object-kind.h"
 #include "store/store-owners.h"
 #include "store/store-util.h"
 #include "system/object-type-definition.h"
 #include "system/player-type-definition.h"
 
 /*!
- * @brief ブラックマーケット用の無価値品の排除判定 /
- * This function will keep 'crap' out of the black market.
- * @param player_ptr プレイヤーへの参照ポインタ
+ * @brief 品質から見てブラックマーケットで売る価値のない品かを返す
  * @param o_ptr 判定したいオブジェクトの構造体参照ポインタ
- * @return ブラックマーケットにとって無価値な品ならばTRUEを返す
- * @details
- * <pre>
- * Crap is defined as any item that is "available" elsewhere
- * Based on a suggestion by "Lee Vogt" <lvogt@cig.mcel.mot.com>
- * </pre>
+ * @return エゴでも修正値付きでもなければTRUEを返す
  */
-bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr)
+static bool is_plain_item(const ObjectType *o_ptr)
 {
     if (o_ptr->is_ego()) {
         return false;
@@ -31,7 +25,40 @@ bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr)
         return false;
     }
 
-    if (o_ptr->to_d > 0) {
+    return o_ptr->to_d <= 0;
+}
+
+/*!
+ * @brief 店の在庫に同じベースアイテムがあるかを返す
+ * @param st_ptr 店舗への参照ポインタ
+ * @param k_idx ベースアイテムID
+ */
+static bool is_on_sale_at(const store_type *st_ptr, KIND_OBJECT_IDX k_idx)
+{
+    for (int j = 0; j < st_ptr->stock_num; j++) {
+        if (st_ptr->stock[j].k_idx == k_idx) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * @brief ブラックマーケット用の無価値品の排除判定 /
+ * This function will keep 'crap' out of the black market.
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param o_ptr 判定したいオブジェクトの構造体参照ポインタ
+ * @return ブラックマーケットにとって無価値な品ならばTRUEを返す
+ * @details
+ * <pre>
+ * Crap is defined as any item that is "available" elsewhere
+ * Based on a suggestion by "Lee Vogt" <lvogt@cig.mcel.mot.com>
+ * </pre>
+ */
+bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr)
+{
+    if (!is_plain_item(o_ptr)) {
         return false;
     }
 
@@ -40,13 +67,54 @@ bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr)
             continue;
         }
 
-        for (int j = 0; j < town_info[player_ptr->town_num].store[enum2i(sst)].stock_num; j++) {
-            auto *j_ptr = &town_info[player_ptr->town_num].store[enum2i(sst)].stock[j];
-            if (o_ptr->k_idx == j_ptr->k_idx) {
-                return true;
-            }
+        if (is_on_sale_at(&town_info[player_ptr->town_num].store[enum2i(sst)], o_ptr->k_idx)) {
+            return true;
         }
     }
 
     return false;
 }
+
+/*!
+ * @brief ブラックマーケット以外の店の在庫にあるベースアイテムの一覧を作る
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @return ベースアイテムIDごとに、いずれかの店の在庫にあるか
+ * @details ブラックマーケットの品揃えを変化させる間は他の店の在庫は変わらないため、最初に一度だけ作ればよい
+ */
+std::vector<bool> make_kinds_on_sale_elsewhere(PlayerType *player_ptr)
+{
+    std::vector<bool> kinds_on_sale(k_info.size());
+    for (auto sst : STORE_SALE_TYPE_LIST) {
+        if (sst == StoreSaleType::HOME || sst == StoreSaleType::MUSEUM || sst == StoreSaleType::BLACK) {
+            continue;
+        }
+
+        const auto *st_ptr = &town_info[player_ptr->town_num].store[enum2i(sst)];
+        for (int j = 0; j < st_ptr->stock_num; j++) {
+            kinds_on_sale[st_ptr->stock[j].k_idx] = true;
+        }
+    }
+
+    return kinds_on_sale;
+}
+
+/*!
+ * @brief ブラックマーケット用の無価値品の排除判定 (他の店の在庫一覧を使う版)
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param o_ptr 判定したいオブジェクトの構造体参照ポインタ
+ * @param kinds_on_sale_elsewhere make_kinds_on_sale_elsewhere() で作った在庫一覧
+ * @return ブラックマーケットにとって無価値な品ならばTRUEを返す
+ * @details ブラックマーケット自身の在庫だけを毎回調べる。結果は black_market_crap() と同じ
+ */
+bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr, const std::vector<bool> &kinds_on_sale_elsewhere)
+{
+    if (!is_plain_item(o_ptr)) {
+        return false;
+    }
+
+    if (kinds_on_sale_elsewhere[o_ptr->k_idx]) {
+        return true;
+    }
+
+    return is_on_sale_at(&town_info[player_ptr->town_num].store[enum2i(StoreSaleType::BLACK)], o_ptr->k_idx);
+}
@@ -1,5 +1,9 @@
 ﻿#pragma once
 
+#include <vector>
+
 class ObjectType;
 class PlayerType;
 bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr);
+std::vector<bool> make_kinds_on_sale_elsewhere(PlayerType *player_ptr);
+bool black_market_crap(PlayerType *player_ptr, ObjectType *o_ptr, const std::vector<bool> &kinds_on_sale_elsewhere);
@@ -34,6 +34,7 @@
 #include "util/quarks.h"
 #include "view/display-messages.h"
 #include "world/world-object.h"
+#include <vector>
 
 int store_top = 0;
 int store_bottom = 0;
@@ -301,10 +302,22 @@ void store_shuffle(PlayerType *player_ptr, StoreSaleType store_num)
     }
 }
 
+/*!
+ * @brief 1つの店の品揃えを変化させる間、使い回す候補テーブル
+ * @details 品揃えの変化中は生成制約も他の店の在庫も変わらないため、最初に一度だけ作ればよい
+ */
+struct store_restock_tables {
+    ObjectKindSelector black_market_kinds{ 0x00000000 }; //!< ブラックマーケットに並べるアイテムの生成階ごとの候補
+    std::vector<bool> kinds_on_sale_elsewhere; //!< ブラックマーケット以外の店の在庫にあるベースアイテム
+};
+
 /*!
  * @brief 店舗の品揃え変化のためにアイテムを追加する /
  * Creates a random item and gives it to a store
  * @param player_ptr プレイヤーへの参照ポインタ
+ * @param fix_k_idx 必ず並べるベースアイテムID (なければ0)
+ * @param store_num 店舗種類のID
+ * @param tables 品揃えの変化中に使い回す候補テーブル
  * @details
  * <pre>
  * This algorithm needs to be rethought.  A lot.
@@ -315,7 +328,7 @@ void store_shuffle(PlayerType *player_ptr, StoreSaleType store_num)
  * Should we check for "permission" to have the given item?
  * </pre>
  */
-static void store_create(PlayerType *player_ptr, KIND_OBJECT_IDX fix_k_idx, StoreSaleType store_num)
+static void store_create(PlayerType *player_ptr, KIND_OBJECT_IDX fix_k_idx, StoreSaleType store_num, store_restock_tables &tables)
 {
     if (st_ptr->stock_num >= st_ptr->stock_size) {
         return;
@@ -328,7 +341,7 @@ static void store_create(PlayerType *player_ptr, KIND_OBJECT_IDX fix_k_idx, Stor
         DEPTH level;
         if (store_num == StoreSaleType::BLACK) {
             level = 25 + randint0(25);
-            k_idx = get_obj_num(player_ptr, level, 0x00000000);
+            k_idx = tables.black_market_kinds.get_obj_num(player_ptr, level);
             if (k_idx == 0) {
                 continue;
             }
@@ -372,7 +385,7 @@ static void store_create(PlayerType *player_ptr, KIND_OBJECT_IDX fix_k_idx, Stor
         }
 
         if (store_num == StoreSaleType::BLACK) {
-            if (black_market_crap(player_ptr, q_ptr) || (object_value(q_ptr) < 10)) {
+            if (black_market_crap(player_ptr, q_ptr, tables.kinds_on_sale_elsewhere) || (object_value(q_ptr) < 10)) {
                 continue;
             }
         } else {
@@ -394,6 +407,9 @@ static void store_create(PlayerType *player_ptr, KIND_OBJECT_IDX fix_k_idx, Stor
  * @param town_num 町のID
  * @param store_num 店舗種類のID
  * @param chance 更新商品数
+ * @details
+ * 前回訪れてから経過した更新回数 (chance) 分の入れ替え数をまとめて決め、品揃えを一度に変化させる。
+ * ブラックマーケットの候補テーブルと他の店の在庫一覧は最初に一度だけ作り、品揃えの変化中は使い回す。
  */
 void store_maintenance(PlayerType *player_ptr, int town_num, StoreSaleType store_num, int chance)
 {
@@ -404,10 +420,12 @@ void store_maintenance(PlayerType *player_ptr, int town_num, StoreSaleType store
     st_ptr = &town_info[town_num].store[enum2i(store_num)];
     ot_ptr = &owners.at(store_num)[st_ptr->owner];
     st_ptr->insult_cur = 0;
+    store_restock_tables tables;
     if (store_num == StoreSaleType::BLACK) {
+        tables.kinds_on_sale_elsewhere = make_kinds_on_sale_elsewhere(player_ptr);
         for (INVENTORY_IDX j = st_ptr->stock_num - 1; j >= 0; j--) {
             auto *o_ptr = &st_ptr->stock[j];
-            if (black_market_crap(player_ptr, o_ptr)) {
+            if (black_market_crap(player_ptr, o_ptr, tables.kinds_on_sale_elsewhere)) {
                 store_item_increase(j, 0 - o_ptr->number);
                 store_item_optimize(j);
             }
@@ -455,14 +473,14 @@ void store_maintenance(PlayerType *player_ptr, int town_num, StoreSaleType store
     }
 
     for (size_t k = 0; k < st_ptr->regular.size(); k++) {
-        store_create(player_ptr, st_ptr->regular[k], store_num);
+        store_create(player_ptr, st_ptr->regular[k], store_num, tables);
         if (st_ptr->stock_num >= STORE_MAX_KEEP) {
             break;
         }
     }
 
     while (st_ptr->stock_num < j) {
-        store_create(player_ptr, 0, store_num);
+        store_create(player_ptr, 0, store_num, tables);
     }
 }
 
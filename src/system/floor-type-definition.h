@@ -40,9 +40,10 @@ struct floor_type {
     POSITION lite_y[LITE_MAX];
     POSITION lite_x[LITE_MAX];
 
-    POSITION_IDX mon_lite_n; //!< Array of grids lit by player lite
-    POSITION mon_lite_y[MON_LITE_MAX];
-    POSITION mon_lite_x[MON_LITE_MAX];
+    uint32_t sight_epoch; //!< 視界・光源・地形のいずれかが変わるたびに進む世代番号 (モンスターの光源の再計算判定用)
+    uint32_t terrain_epoch; //!< 地形が変わるたびに進む世代番号 (視界の再計算判定用)
+    uint32_t o_list_epoch; //!< アイテムの生成・削除・詰め直しのたびに進む世代番号 (感知範囲の検索用)
+    uint32_t m_list_epoch; //!< モンスターの生成・削除・詰め直しのたびに進む世代番号 (行動順の一覧の再構築判定用)
 
     POSITION_IDX view_n; //!< Array of grids viewable to the player
     POSITION view_y[VIEW_MAX];
@@ -637,3 +637,47 @@ bool ObjectType::can_pile(const ObjectType *j_ptr) const
 
     return true;
 }
+
+/*!
+ * @brief アイテムの状態が同じかを判定する
+ * @param j_ptr 比べるアイテム
+ * @return 同じ状態か
+ * @details
+ * 表記やザックのまとめ直し・並べ替えの結果を使い回してよいかの判定に用いる。
+ * 位置・スタック内の順番・マーク・所持者・生成時のバイアスなど、アイテムそのものの状態でない項目は比べない。
+ */
+bool ObjectType::is_same_state(const ObjectType *j_ptr) const
+{
+    return (this->k_idx == j_ptr->k_idx) &&
+           (this->tval == j_ptr->tval) &&
+           (this->sval == j_ptr->sval) &&
+           (this->pval == j_ptr->pval) &&
+           (this->discount == j_ptr->discount) &&
+           (this->number == j_ptr->number) &&
+           (this->weight == j_ptr->weight) &&
+           (this->fixed_artifact_idx == j_ptr->fixed_artifact_idx) &&
+           (this->ego_idx == j_ptr->ego_idx) &&
+           (this->activation_id == j_ptr->activation_id) &&
+           (this->chest_level == j_ptr->chest_level) &&
+           (this->captured_monster_speed == j_ptr->captured_monster_speed) &&
+           (this->captured_monster_current_hp == j_ptr->captured_monster_current_hp) &&
+           (this->captured_monster_max_hp == j_ptr->captured_monster_max_hp) &&
+           (this->fuel == j_ptr->fuel) &&
+           (this->smith_hit == j_ptr->smith_hit) &&
+           (this->smith_damage == j_ptr->smith_damage) &&
+           (this->smith_effect == j_ptr->smith_effect) &&
+           (this->smith_act_idx == j_ptr->smith_act_idx) &&
+           (this->to_h == j_ptr->to_h) &&
+           (this->to_d == j_ptr->to_d) &&
+           (this->to_a == j_ptr->to_a) &&
+           (this->ac == j_ptr->ac) &&
+           (this->dd == j_ptr->dd) &&
+           (this->ds == j_ptr->ds) &&
+           (this->timeout == j_ptr->timeout) &&
+           (this->ident == j_ptr->ident) &&
+           (this->inscription == j_ptr->inscription) &&
+           (this->art_name == j_ptr->art_name) &&
+           (this->feeling == j_ptr->feeling) &&
+           (this->art_flags == j_ptr->art_flags) &&
+           (this->curse_flags == j_ptr->curse_flags);
+}
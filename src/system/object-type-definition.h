@@ -19,6 +19,9 @@ enum class ItemKindType : short;
 enum class SmithEffectType : int16_t;
 enum class RandomArtActType : short;
 
+/*!
+ * @details メンバ変数を追加した場合は、is_same_state() で比べるかどうかも合わせて決めること
+ */
 class ObjectType {
 public:
     ObjectType() = default;
@@ -114,4 +117,5 @@ public:
     bool is_fuel() const;
     bool is_glove_same_temper(const ObjectType *j_ptr) const;
     bool can_pile(const ObjectType *j_ptr) const;
+    bool is_same_state(const ObjectType *j_ptr) const;
 };
@@ -2,6 +2,7 @@
 #include "effect/effect-characteristics.h"
 #include "effect/spells-effect-util.h"
 #include "floor/cave.h"
+#include "floor/grid-pair-cache.h"
 #include "grid/feature-flag-types.h"
 #include "spell-class/spells-mirror-master.h"
 #include "system/floor-type-definition.h"
@@ -274,20 +275,27 @@ projection_path::projection_path(PlayerType *player_ptr, POSITION range, POSITIO
  * at the final destination, assuming no monster gets in the way.
  *
  * This is slightly (but significantly) different from "los(y1,x1,y2,x2)".
+ *
+ * 経路は地形と射程だけで決まるので、結果をキャッシュに記録して使い回す。
  */
 bool projectable(PlayerType *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
 {
-    projection_path grid_g(player_ptr, (project_length ? project_length : get_max_range(player_ptr)), y1, x1, y2, x2, 0);
-    if (grid_g.path_num() == 0) {
-        return true;
+    const auto range = project_length ? project_length : get_max_range(player_ptr);
+    auto *floor_ptr = player_ptr->current_floor_ptr;
+    auto &cache = get_projectable_cache();
+    if (const auto cached = cache.find(floor_ptr, y1, x1, y2, x2, range); cached) {
+        return *cached;
     }
 
-    const auto [y, x] = grid_g.back();
-    if ((y != y2) || (x != x2)) {
-        return false;
+    projection_path grid_g(player_ptr, range, y1, x1, y2, x2, 0);
+    auto result = true;
+    if (grid_g.path_num() != 0) {
+        const auto [y, x] = grid_g.back();
+        result = (y == y2) && (x == x2);
     }
 
-    return true;
+    cache.store(floor_ptr, y1, x1, y2, x2, result, range);
+    return result;
 }
 
 /*!
@@ -13,6 +13,7 @@
 #include "term/z-form.h"
 #include "term/z-util.h"
 #include "term/z-virt.h"
+#include <algorithm>
 #include <vector>
 
 /*
@@ -671,9 +672,12 @@ char *vformat(concptr fmt, va_list vp)
     /* Keep going until successful */
     while (true) {
         uint len;
+        va_list vp_copy;
 
-        /* Build the string */
-        len = vstrnfmt(format_buf.data(), format_buf.size(), fmt, vp);
+        /* Build the string (the arguments may be needed again) */
+        va_copy(vp_copy, vp);
+        len = vstrnfmt(format_buf.data(), format_buf.size(), fmt, vp_copy);
+        va_end(vp_copy);
 
         /* Success */
         if (len < format_buf.size() - 1) {
@@ -688,6 +692,52 @@ char *vformat(concptr fmt, va_list vp)
     return format_buf.data();
 }
 
+/*
+ * Do a vstrnfmt (see above) directly into the end of a string.
+ * The string keeps its capacity, so a string reused as a builder
+ * stops allocating once it has grown large enough.
+ */
+void vformat_append(std::string &dst, concptr fmt, va_list vp)
+{
+    const auto old_len = dst.size();
+    auto room = std::max<size_t>(dst.capacity() - old_len, 256);
+    while (true) {
+        va_list vp_copy;
+
+        /* Build the string right after the current contents */
+        dst.resize(old_len + room);
+        va_copy(vp_copy, vp);
+        const auto len = vstrnfmt(&dst[old_len], static_cast<uint>(room), fmt, vp_copy);
+        va_end(vp_copy);
+
+        /* Success */
+        if (len < room - 1) {
+            dst.resize(old_len + len);
+            return;
+        }
+
+        /* Grow the room */
+        room *= 2;
+    }
+}
+
+/*
+ * Do a vformat_append (see above).
+ */
+void format_append(std::string &dst, concptr fmt, ...)
+{
+    va_list vp;
+
+    /* Begin the Varargs Stuff */
+    va_start(vp, fmt);
+
+    /* Append to the string */
+    vformat_append(dst, fmt, vp);
+
+    /* End the Varargs Stuff */
+    va_end(vp);
+}
+
 /*
  * Do a vstrnfmt (see above) into a buffer of a given size.
  */
@@ -12,6 +12,7 @@
 #define INCLUDED_Z_FORM_H
 
 #include "system/h-basic.h"
+#include <string>
 
 /*
  * This file provides functions very similar to "sprintf()", but which
@@ -41,6 +42,62 @@ extern char *vformat(concptr fmt, va_list vp);
 /* Simple interface to "vformat()" */
 extern char *format(concptr fmt, ...);
 
+/* Format arguments and append them to the end of a string */
+extern void vformat_append(std::string &dst, concptr fmt, va_list vp);
+
+/* Simple interface to "vformat_append()" */
+extern void format_append(std::string &dst, concptr fmt, ...);
+
+/*
+ * Format arguments into a caller-provided array, whose length is known
+ * from its type.  The result is always terminated.
+ */
+template <size_t N>
+uint format_to(char (&buf)[N], concptr fmt, ...)
+{
+    va_list vp;
+    va_start(vp, fmt);
+    const auto len = vstrnfmt(buf, N, fmt, vp);
+    va_end(vp);
+    return len;
+}
+
+/*
+ * A fixed-length buffer holding one formatted string.
+ *
+ * Unlike "format()", each temporary owns its result, so several of them
+ * may be used in one expression without clobbering each other, and no
+ * static buffer or heap allocation is involved.  Results longer than
+ * N - 1 bytes are truncated.
+ *
+ *   c_put_str(attr, FormatBuffer<16>("%5.5s", text).c_str(), row, col);
+ */
+template <size_t N>
+class FormatBuffer {
+public:
+    FormatBuffer(concptr fmt, ...)
+    {
+        va_list vp;
+        va_start(vp, fmt);
+        this->len = vstrnfmt(this->buf, N, fmt, vp);
+        va_end(vp);
+    }
+
+    concptr c_str() const
+    {
+        return this->buf;
+    }
+
+    uint length() const
+    {
+        return this->len;
+    }
+
+private:
+    char buf[N]{};
+    uint len = 0;
+};
+
 /* Vararg interface to "plog()", using "format()" */
 extern void plog_fmt(concptr fmt, ...);
 
@@ -0,0 +1,224 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 0から始まるIDをキーとし、要素を配列に詰めて持つ std::map 風の表
+ *
+ * 要素はIDを添字とする配列に並ぶため、IDからの参照は木を辿らず添字1回で済む。
+ * 走査は登録済の要素だけをIDの昇順に辿るので、std::map と同じ順になる。
+ * IDの抜けは未登録の要素として配列に残し、走査では飛ばす。
+ *
+ * 配列の範囲外のIDを登録すると配列を伸ばすため、それまでの要素への参照は無効になる。
+ * 範囲外のIDを登録するのはデータファイルの読み込み中だけを想定している。
+ *
+ * @tparam Key ID の型 (整数型または列挙型)
+ * @tparam Value 要素の型
+ */
+template <typename Key, typename Value>
+class IndexedMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+
+    /**
+     * @brief 登録済の要素だけを辿るイテレータ
+     * @tparam IsConst const なイテレータか
+     */
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = IndexedMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+        using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+        using owner_pointer = std::conditional_t<IsConst, const IndexedMap *, IndexedMap *>;
+
+        Iterator() = default;
+        Iterator(owner_pointer owner, size_type pos)
+            : owner(owner)
+            , pos(pos)
+        {
+            this->skip_absent();
+        }
+
+        operator Iterator<true>() const
+        {
+            return Iterator<true>(this->owner, this->pos);
+        }
+
+        reference operator*() const
+        {
+            return this->owner->entries[this->pos];
+        }
+
+        pointer operator->() const
+        {
+            return &this->owner->entries[this->pos];
+        }
+
+        Iterator &operator++()
+        {
+            this->pos++;
+            this->skip_absent();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto it = *this;
+            ++(*this);
+            return it;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return this->pos == other.pos;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return this->pos != other.pos;
+        }
+
+    private:
+        friend class IndexedMap;
+        owner_pointer owner = nullptr;
+        size_type pos = 0;
+
+        void skip_absent()
+        {
+            while ((this->pos < this->owner->entries.size()) && !this->owner->present[this->pos]) {
+                this->pos++;
+            }
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    IndexedMap() = default;
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, this->entries.size());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, this->entries.size());
+    }
+
+    size_type size() const
+    {
+        return this->count;
+    }
+
+    bool empty() const
+    {
+        return this->count == 0;
+    }
+
+    /**
+     * @brief IDに対応する要素を返す。未登録なら既定値で登録する
+     * @param key ID
+     * @return 要素への参照
+     */
+    Value &operator[](const Key &key)
+    {
+        const auto pos = static_cast<size_type>(key);
+        if ((pos < this->entries.size()) && this->present[pos]) {
+            return this->entries[pos].second;
+        }
+
+        return this->emplace_at(key, Value{})->second;
+    }
+
+    /**
+     * @brief 登録済のIDに対応する要素を返す
+     * @param key ID
+     * @return 要素への参照
+     * @throws std::out_of_range 未登録のIDが指定された場合
+     */
+    Value &at(const Key &key)
+    {
+        return const_cast<Value &>(std::as_const(*this).at(key));
+    }
+
+    const Value &at(const Key &key) const
+    {
+        const auto pos = static_cast<size_type>(key);
+        if ((pos >= this->entries.size()) || !this->present[pos]) {
+            throw std::out_of_range("IndexedMap::at");
+        }
+
+        return this->entries[pos].second;
+    }
+
+    iterator find(const Key &key)
+    {
+        const auto pos = static_cast<size_type>(key);
+        return ((pos < this->entries.size()) && this->present[pos]) ? iterator(this, pos) : this->end();
+    }
+
+    const_iterator find(const Key &key) const
+    {
+        const auto pos = static_cast<size_type>(key);
+        return ((pos < this->entries.size()) && this->present[pos]) ? const_iterator(this, pos) : this->end();
+    }
+
+    /**
+     * @brief 要素を登録する。登録済なら何もしない
+     * @param key ID
+     * @param value 登録する要素
+     * @return 登録した (または登録済の) 要素を指すイテレータ
+     * @details 位置のヒントは std::map との互換のために受け取るだけで使わない
+     */
+    iterator emplace_hint(const_iterator, const Key &key, Value &&value)
+    {
+        return this->emplace_at(key, std::move(value));
+    }
+
+private:
+    std::vector<value_type> entries; //!< IDを添字とする要素の配列 (未登録の要素を含む)
+    std::vector<bool> present; //!< IDごとに登録済か
+    size_type count = 0; //!< 登録済の要素数
+
+    iterator emplace_at(const Key &key, Value &&value)
+    {
+        const auto pos = static_cast<size_type>(key);
+        if (pos >= this->entries.size()) {
+            for (auto i = this->entries.size(); i <= pos; i++) {
+                this->entries.emplace_back(static_cast<Key>(i), Value{});
+            }
+
+            this->present.resize(pos + 1);
+        }
+
+        if (!this->present[pos]) {
+            this->entries[pos].second = std::move(value);
+            this->present[pos] = true;
+            this->count++;
+        }
+
+        return iterator(this, pos);
+    }
+};
@@ -1,6 +1,7 @@
 ﻿#include "util/quarks.h"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace {
@@ -16,6 +17,11 @@ constexpr auto QUARK_MAX = 768;
  * The pointers to the quarks [QUARK_MAX]
  */
 std::vector<std::string> quark__str;
+
+/*
+ * The index of each quark, keyed by its string
+ */
+std::unordered_map<std::string, ushort> quark__idx;
 }
 
 /*
@@ -24,8 +30,12 @@ std::vector<std::string> quark__str;
 void quark_init(void)
 {
     //! @note [0]は使用しない、[1]は空文字列固定
+    //! @note 最大数まで先に確保し、quark_str() が返したポインタが追加で無効にならないようにする
+    quark__str.reserve(QUARK_MAX);
     quark__str.assign(2, {});
     quark__str[1] = "";
+    quark__idx.clear();
+    quark__idx.emplace(quark__str[1], static_cast<ushort>(1));
 }
 
 /*
@@ -33,10 +43,9 @@ void quark_init(void)
  */
 ushort quark_add(concptr str)
 {
-    for (uint16_t i = 1; i < quark__str.size(); i++) {
-        if (streq(quark__str[i], str)) {
-            return i;
-        }
+    const auto it = quark__idx.find(str);
+    if (it != quark__idx.end()) {
+        return it->second;
     }
 
     if (quark__str.size() >= QUARK_MAX) {
@@ -44,7 +53,9 @@ ushort quark_add(concptr str)
     }
 
     quark__str.emplace_back(str);
-    return static_cast<uint16_t>(quark__str.size() - 1);
+    const auto i = static_cast<ushort>(quark__str.size() - 1);
+    quark__idx.emplace(quark__str[i], i);
+    return i;
 }
 
 /*
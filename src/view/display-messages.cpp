@@ -12,10 +12,9 @@
 #include "util/int-char-converter.h"
 #include "world/world.h"
 
-#include <deque>
-#include <map>
-#include <memory>
+#include <algorithm>
 #include <string>
+#include <vector>
 
 /* Used in msg_print() for "buffering" */
 bool msg_flag;
@@ -27,42 +26,111 @@ namespace {
 /*! 表示するメッセージの先頭位置 */
 static int msg_head_pos = 0;
 
-using msg_sp = std::shared_ptr<const std::string>;
-using msg_wp = std::weak_ptr<const std::string>;
+/*! 1件のメッセージ本文の最大長 (message_add_aux() で分割した80桁と、繰り返しの回数表示「 <x1000>」) */
+constexpr size_t MESSAGE_LENGTH_MAX = 80 + sizeof(" <x1000>") - 1;
 
-/** メッセージが同一かどうかを比較するためのラムダ式 */
-auto string_ptr_cmp = [](const std::string *a, const std::string *b) { return *a < *b; };
+/*!
+ * メッセージ本文を詰めて格納する領域の大きさ
+ * @details 最大長の本文 MESSAGE_MAX 件に加え、末尾で折り返す際に使わずに残る余りの1件分を確保する。
+ * 本文の長さに関わらず、履歴は件数 (MESSAGE_MAX - 1 件) でのみ捨てられる。
+ */
+constexpr size_t MESSAGE_BUF = (MESSAGE_MAX + 1) * (MESSAGE_LENGTH_MAX + 1);
 
-/** 同一メッセージの検索に使用するmapオブジェクト。
- * 同一メッセージがあるかどうかを検索し、ヒットしたらweak_ptrからshared_ptrを作成しメッセージを共有する。
- * message_historyのカスタムデリータの中で参照するので、message_historyより先に宣言しなければならない事に注意。
+/*!
+ * @brief メッセージ履歴の1件
  */
-std::map<const std::string *, msg_wp, decltype(string_ptr_cmp)> message_map(string_ptr_cmp);
+struct message_entry {
+    uint32_t offset; //!< message_buf 中の本文の位置
+    uint32_t length; //!< 本文の長さ (終端のヌル文字を含まない)
+};
 
-/** メッセージ履歴 */
-std::deque<msg_sp> message_history;
+/** メッセージ本文のリングバッファ。各本文はヌル文字で終端して連続して格納し、古いものから上書きする */
+std::vector<char> message_buf;
 
-/**
- * @brief メッセージを保持する msg_sp オブジェクトを生成する
- *
- * @tparam T メッセージの型。std::string / std::string_view / const char* 等
+/** message_buf の次に書き込む位置 */
+size_t message_buf_head = 0;
+
+/** メッセージ履歴のリングバッファ (固定長) */
+std::vector<message_entry> message_entries;
+
+/** 最新のメッセージの message_entries 中の位置 */
+size_t message_newest = 0;
+
+/** 保持しているメッセージの数 */
+size_t message_count = 0;
+
+/*!
+ * @brief 指定した世代のメッセージを取得する
+ * @param age メッセージの世代 (0が最新)
+ * @return メッセージ
+ */
+const message_entry &message_at(size_t age)
+{
+    return message_entries[(message_newest + MESSAGE_MAX - age) % MESSAGE_MAX];
+}
+
+/*!
+ * @brief 最も古いメッセージを捨てる
+ */
+void message_drop_oldest()
+{
+    message_count--;
+}
+
+/*!
+ * @brief 最新のメッセージを取り除く
+ * @details 本文は最後に書き込んだものなので、書き込み位置も戻して領域を再利用する
+ */
+void message_drop_newest()
+{
+    message_buf_head = message_at(0).offset;
+    message_newest = (message_newest + MESSAGE_MAX - 1) % MESSAGE_MAX;
+    message_count--;
+}
+
+/*!
+ * @brief メッセージ履歴の末尾 (最新) にメッセージを追加する
  * @param str メッセージ
- * @return 生成した msg_sp オブジェクト
+ * @details 本文を書き込む領域と重なる古いメッセージは先に捨てる。
+ * MESSAGE_BUF は最大長の本文で埋まっても足りる大きさなので、実際には件数の上限で捨てるものしかない。
  */
-template <typename T>
-msg_sp make_message(T &&str)
+void message_push(std::string_view str)
 {
-    /** std::stringオブジェクトと同時にmessage_mapのエントリも削除するカスタムデリータ */
-    auto deleter = [](std::string *s) {
-        message_map.erase(s);
-        delete s;
-    };
+    if (message_buf.empty()) {
+        message_buf.resize(MESSAGE_BUF);
+        message_entries.resize(MESSAGE_MAX);
+    }
+
+    const auto size = std::min(str.length(), MESSAGE_LENGTH_MAX) + 1;
+    auto start = message_buf_head;
+    if (start + size > MESSAGE_BUF) {
+        /* 末尾の余りは使わずに先頭へ戻る。余りにある本文は今残っている中で最も古い */
+        while ((message_count > 0) && (message_at(message_count - 1).offset >= start)) {
+            message_drop_oldest();
+        }
+
+        start = 0;
+    }
+
+    while (message_count > 0) {
+        const auto &oldest = message_at(message_count - 1);
+        if ((oldest.offset >= start + size) || (oldest.offset + oldest.length + 1 <= start)) {
+            break;
+        }
 
-    // 新たにメッセージを保持する msg_sp オブジェクトを生成し、検索用mapオブジェクトにも追加する
-    auto new_msg = msg_sp(new std::string(std::forward<T>(str)), std::move(deleter));
-    message_map.emplace(new_msg.get(), msg_wp(new_msg));
+        message_drop_oldest();
+    }
+
+    if (message_count == MESSAGE_MAX - 1) {
+        message_drop_oldest();
+    }
 
-    return new_msg;
+    std::copy_n(str.data(), size - 1, &message_buf[start]);
+    message_buf[start + size - 1] = '\0';
+    message_buf_head = start + size;
+    message_newest = (message_newest + 1) % MESSAGE_MAX;
+    message_entries[message_newest] = { static_cast<uint32_t>(start), static_cast<uint32_t>(size - 1) };
+    message_count++;
 }
 }
 
@@ -72,13 +140,13 @@ msg_sp make_message(T &&str)
  */
 int32_t message_num(void)
 {
-    return message_history.size();
+    return static_cast<int32_t>(message_count);
 }
 
 /*!
  * @brief 過去のゲームメッセージを返す。 / Recall the "text" of a saved message
  * @param age メッセージの世代
- * @return メッセージの文字列ポインタ
+ * @return メッセージの文字列ポインタ (次にメッセージを追加するまで有効)
  */
 concptr message_str(int age)
 {
@@ -86,7 +154,7 @@ concptr message_str(int age)
         return "";
     }
 
-    return message_history[age]->c_str();
+    return &message_buf[message_at(age).offset];
 }
 
 static void message_add_aux(std::string str)
@@ -126,9 +194,9 @@ static void message_add_aux(std::string str)
     }
 
     // 直前と同じメッセージの場合、「～ <xNN>」と表示する
-    if (!message_history.empty()) {
+    if (message_count > 0) {
         const char *t;
-        std::string_view last_message = *message_history.front();
+        std::string_view last_message(&message_buf[message_at(0).offset], message_at(0).length);
 #ifdef JP
         for (t = last_message.data(); *t && (*t != '<' || (*(t + 1) != 'x')); t++) {
             if (iskanji(*t)) {
@@ -149,8 +217,8 @@ static void message_add_aux(std::string str)
         }
 
         if (str == last_message && (j < 1000)) {
-            str = format("%s <x%d>", str.c_str(), j + 1);
-            message_history.pop_front();
+            format_append(str, " <x%d>", j + 1);
+            message_drop_newest();
             if (!now_message) {
                 now_message++;
             }
@@ -161,23 +229,7 @@ static void message_add_aux(std::string str)
         }
     }
 
-    msg_sp add_msg;
-
-    // メッセージ履歴から同一のメッセージを探す
-    if (const auto &it = message_map.find(&str); it != message_map.end()) {
-        // 同一のメッセージが見つかったならそのメッセージの msg_sp オブジェクトを複製
-        add_msg = it->second.lock();
-    } else {
-        // 見つからなかった場合は新たに msg_sp オブジェクトを作成
-        add_msg = make_message(std::move(str));
-    }
-
-    // メッセージ履歴に追加
-    message_history.push_front(std::move(add_msg));
-
-    if (message_history.size() == MESSAGE_MAX) {
-        message_history.pop_back();
-    }
+    message_push(str);
 
     if (!splitted.empty()) {
         message_add_aux(std::move(splitted));
@@ -337,7 +389,8 @@ void msg_print(std::string_view msg)
 
     std::string msg_includes_turn;
     if (cheat_turn) {
-        msg = msg_includes_turn = format("T:%d - %s", w_ptr->game_turn, msg.data());
+        format_append(msg_includes_turn, "T:%d - %s", w_ptr->game_turn, msg.data());
+        msg = msg_includes_turn;
     }
 
     if ((msg_head_pos > 0) && ((msg_head_pos + msg.size()) > 72)) {
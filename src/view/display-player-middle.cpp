@@ -87,7 +87,7 @@ static void display_sub_hand(PlayerType *player_ptr)
     uint stance_num = enum2i(pc.get_monk_stance()) - 1;
 
     if (stance_num < monk_stances.size()) {
-        display_player_one_line(ENTRY_POSTURE, format(_("%sの構え", "%s form"), monk_stances[stance_num].desc), TERM_YELLOW);
+        display_player_one_line(ENTRY_POSTURE, FormatBuffer<64>(_("%sの構え", "%s form"), monk_stances[stance_num].desc).c_str(), TERM_YELLOW);
     }
 }
 
@@ -115,7 +115,7 @@ static void display_hit_damage(PlayerType *player_ptr)
 
     show_tohit += player_ptr->skill_thb / BTH_PLUS_ADJ;
 
-    display_player_one_line(ENTRY_SHOOT_HIT_DAM, format("(%+d,%+d)", show_tohit, show_todam), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SHOOT_HIT_DAM, FormatBuffer<32>("(%+d,%+d)", show_tohit, show_todam).c_str(), TERM_L_BLUE);
 }
 
 /*!
@@ -134,7 +134,7 @@ static void display_shoot_magnification(PlayerType *player_ptr)
         tmul = tmul * (100 + (int)(adj_str_td[player_ptr->stat_index[A_STR]]) - 128);
     }
 
-    display_player_one_line(ENTRY_SHOOT_POWER, format("x%d.%02d", tmul / 100, tmul % 100), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SHOOT_POWER, FormatBuffer<32>("x%d.%02d", tmul / 100, tmul % 100).c_str(), TERM_L_BLUE);
 }
 
 /*!
@@ -233,7 +233,7 @@ static void display_player_speed(PlayerType *player_ptr, TERM_COLOR attr, int ba
     }
 
     display_player_one_line(ENTRY_SPEED, buf, attr);
-    display_player_one_line(ENTRY_LEVEL, format("%d", player_ptr->lev), TERM_L_GREEN);
+    display_player_one_line(ENTRY_LEVEL, FormatBuffer<32>("%d", player_ptr->lev).c_str(), TERM_L_GREEN);
 }
 
 /*!
@@ -245,13 +245,13 @@ static void display_player_exp(PlayerType *player_ptr)
     PlayerRace pr(player_ptr);
     int e = pr.equals(PlayerRaceType::ANDROID) ? ENTRY_EXP_ANDR : ENTRY_CUR_EXP;
     if (player_ptr->exp >= player_ptr->max_exp) {
-        display_player_one_line(e, format("%ld", player_ptr->exp), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer<32>("%ld", player_ptr->exp).c_str(), TERM_L_GREEN);
     } else {
-        display_player_one_line(e, format("%ld", player_ptr->exp), TERM_YELLOW);
+        display_player_one_line(e, FormatBuffer<32>("%ld", player_ptr->exp).c_str(), TERM_YELLOW);
     }
 
     if (!pr.equals(PlayerRaceType::ANDROID)) {
-        display_player_one_line(ENTRY_MAX_EXP, format("%ld", player_ptr->max_exp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_MAX_EXP, FormatBuffer<32>("%ld", player_ptr->max_exp).c_str(), TERM_L_GREEN);
     }
 
     e = pr.equals(PlayerRaceType::ANDROID) ? ENTRY_EXP_TO_ADV_ANDR : ENTRY_EXP_TO_ADV;
@@ -259,9 +259,9 @@ static void display_player_exp(PlayerType *player_ptr)
     if (player_ptr->lev >= PY_MAX_LEVEL) {
         display_player_one_line(e, "*****", TERM_L_GREEN);
     } else if (pr.equals(PlayerRaceType::ANDROID)) {
-        display_player_one_line(e, format("%ld", (int32_t)(player_exp_a[player_ptr->lev - 1] * player_ptr->expfact / 100L)), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer<32>("%ld", (int32_t)(player_exp_a[player_ptr->lev - 1] * player_ptr->expfact / 100L)).c_str(), TERM_L_GREEN);
     } else {
-        display_player_one_line(e, format("%ld", (int32_t)(player_exp[player_ptr->lev - 1] * player_ptr->expfact / 100L)), TERM_L_GREEN);
+        display_player_one_line(e, FormatBuffer<32>("%ld", (int32_t)(player_exp[player_ptr->lev - 1] * player_ptr->expfact / 100L)).c_str(), TERM_L_GREEN);
     }
 }
 
@@ -284,19 +284,19 @@ static void display_playtime_in_game(PlayerType *player_ptr)
     display_player_one_line(ENTRY_DAY, buf, TERM_L_GREEN);
 
     if (player_ptr->chp >= player_ptr->mhp) {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_HP, FormatBuffer<32>("%4d/%4d", player_ptr->chp, player_ptr->mhp).c_str(), TERM_L_GREEN);
     } else if (player_ptr->chp > (player_ptr->mhp * hitpoint_warn) / 10) {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_YELLOW);
+        display_player_one_line(ENTRY_HP, FormatBuffer<32>("%4d/%4d", player_ptr->chp, player_ptr->mhp).c_str(), TERM_YELLOW);
     } else {
-        display_player_one_line(ENTRY_HP, format("%4d/%4d", player_ptr->chp, player_ptr->mhp), TERM_RED);
+        display_player_one_line(ENTRY_HP, FormatBuffer<32>("%4d/%4d", player_ptr->chp, player_ptr->mhp).c_str(), TERM_RED);
     }
 
     if (player_ptr->csp >= player_ptr->msp) {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_L_GREEN);
+        display_player_one_line(ENTRY_SP, FormatBuffer<32>("%4d/%4d", player_ptr->csp, player_ptr->msp).c_str(), TERM_L_GREEN);
     } else if (player_ptr->csp > (player_ptr->msp * mana_warn) / 10) {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_YELLOW);
+        display_player_one_line(ENTRY_SP, FormatBuffer<32>("%4d/%4d", player_ptr->csp, player_ptr->msp).c_str(), TERM_YELLOW);
     } else {
-        display_player_one_line(ENTRY_SP, format("%4d/%4d", player_ptr->csp, player_ptr->msp), TERM_RED);
+        display_player_one_line(ENTRY_SP, FormatBuffer<32>("%4d/%4d", player_ptr->csp, player_ptr->msp).c_str(), TERM_RED);
     }
 }
 
@@ -310,7 +310,7 @@ static void display_real_playtime(void)
     uint32_t play_hour = w_ptr->play_time / (60 * 60);
     uint32_t play_min = (w_ptr->play_time / 60) % 60;
     uint32_t play_sec = w_ptr->play_time % 60;
-    display_player_one_line(ENTRY_PLAY_TIME, format("%.2lu:%.2lu:%.2lu", play_hour, play_min, play_sec), TERM_L_GREEN);
+    display_player_one_line(ENTRY_PLAY_TIME, FormatBuffer<32>("%.2lu:%.2lu:%.2lu", play_hour, play_min, play_sec).c_str(), TERM_L_GREEN);
 }
 
 /*!
@@ -327,7 +327,7 @@ void display_player_middle(PlayerType *player_ptr)
     display_sub_hand(player_ptr);
     display_hit_damage(player_ptr);
     display_shoot_magnification(player_ptr);
-    display_player_one_line(ENTRY_BASE_AC, format("[%d,%+d]", player_ptr->dis_ac, player_ptr->dis_to_a), TERM_L_BLUE);
+    display_player_one_line(ENTRY_BASE_AC, FormatBuffer<32>("[%d,%+d]", player_ptr->dis_ac, player_ptr->dis_to_a).c_str(), TERM_L_BLUE);
 
     int base_speed = player_ptr->pspeed - 110;
     if (player_ptr->action == ACTION_SEARCH) {
@@ -338,7 +338,7 @@ void display_player_middle(PlayerType *player_ptr)
     int tmp_speed = calc_temporary_speed(player_ptr);
     display_player_speed(player_ptr, attr, base_speed, tmp_speed);
     display_player_exp(player_ptr);
-    display_player_one_line(ENTRY_GOLD, format("%ld", player_ptr->au), TERM_L_GREEN);
+    display_player_one_line(ENTRY_GOLD, FormatBuffer<32>("%ld", player_ptr->au).c_str(), TERM_L_GREEN);
     display_playtime_in_game(player_ptr);
     display_real_playtime();
 }
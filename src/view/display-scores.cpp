@@ -47,17 +47,13 @@ void display_scores(int from, int to, int note, high_score *score)
         to = MAX_HISCORES;
     }
 
-    if (highscore_seek(0)) {
+    HighScoreList scores;
+    if (scores.load()) {
         return;
     }
 
-    auto num_scores = 0;
+    auto num_scores = scores.size();
     high_score the_score;
-    for (; num_scores < MAX_HISCORES; num_scores++) {
-        if (highscore_read(&the_score)) {
-            break;
-        }
-    }
 
     if ((note == num_scores) && score) {
         num_scores++;
@@ -84,7 +80,9 @@ void display_scores(int from, int to, int note, high_score *score)
                 score = nullptr;
                 note = -1;
                 j--;
-            } else if (highscore_seek(j) || highscore_read(&the_score)) {
+            } else if (j < scores.size()) {
+                the_score = scores.get(j);
+            } else {
                 break;
             }
 
@@ -381,21 +381,23 @@ static void display_first_page(PlayerType *player_ptr, int xthb, int *damage, in
     display_player_one_line(ENTRY_SKILL_DIG, desc, likert_color);
 
     if (!muta_att) {
-        display_player_one_line(ENTRY_BLOWS, format("%d+%d", blows1, blows2), TERM_L_BLUE);
+        display_player_one_line(ENTRY_BLOWS, FormatBuffer<32>("%d+%d", blows1, blows2).c_str(), TERM_L_BLUE);
     } else {
-        display_player_one_line(ENTRY_BLOWS, format("%d+%d+%d", blows1, blows2, muta_att), TERM_L_BLUE);
+        display_player_one_line(ENTRY_BLOWS, FormatBuffer<32>("%d+%d+%d", blows1, blows2, muta_att).c_str(), TERM_L_BLUE);
     }
 
-    display_player_one_line(ENTRY_SHOTS, format("%d.%02d", shots, shot_frac), TERM_L_BLUE);
+    display_player_one_line(ENTRY_SHOTS, FormatBuffer<32>("%d.%02d", shots, shot_frac).c_str(), TERM_L_BLUE);
 
+    char avg_dmg[32];
     if ((damage[0] + damage[1]) == 0) {
         desc = "nil!";
     } else {
-        desc = format("%d+%d", blows1 * damage[0] / 100, blows2 * damage[1] / 100);
+        format_to(avg_dmg, "%d+%d", blows1 * damage[0] / 100, blows2 * damage[1] / 100);
+        desc = avg_dmg;
     }
 
     display_player_one_line(ENTRY_AVG_DMG, desc, TERM_L_BLUE);
-    display_player_one_line(ENTRY_INFRA, format("%d feet", player_ptr->see_infra * 10), TERM_WHITE);
+    display_player_one_line(ENTRY_INFRA, FormatBuffer<32>("%d feet", player_ptr->see_infra * 10).c_str(), TERM_WHITE);
 }
 
 /*!
@@ -192,13 +192,13 @@ void print_depth(PlayerType *player_ptr)
     auto *floor_ptr = player_ptr->current_floor_ptr;
     if (!floor_ptr->dun_level) {
         strcpy(depths, _("地上", "Surf."));
-        c_prt(attr, format("%7s", depths), row_depth, col_depth);
+        c_prt(attr, FormatBuffer<32>("%7s", depths).c_str(), row_depth, col_depth);
         return;
     }
 
     if (inside_quest(floor_ptr->quest_number) && !player_ptr->dungeon_idx) {
         strcpy(depths, _("地上", "Quest"));
-        c_prt(attr, format("%7s", depths), row_depth, col_depth);
+        c_prt(attr, FormatBuffer<32>("%7s", depths).c_str(), row_depth, col_depth);
         return;
     }
 
@@ -244,7 +244,7 @@ void print_depth(PlayerType *player_ptr)
         break; /* Boring place */
     }
 
-    c_prt(attr, format("%7s", depths), row_depth, col_depth);
+    c_prt(attr, FormatBuffer<32>("%7s", depths).c_str(), row_depth, col_depth);
 }
 
 /*!
@@ -325,30 +325,30 @@ void health_redraw(PlayerType *player_ptr, bool riding)
 
         if (MonsterRace(player_ptr->current_floor_ptr->m_list[1].r_idx).is_valid()) {
             term_putstr(col - 2, row, 2, r_info[player_ptr->current_floor_ptr->m_list[1].r_idx].x_attr,
-                format("%c", r_info[player_ptr->current_floor_ptr->m_list[1].r_idx].x_char));
-            term_putstr(col - 1, row, 5, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[1].hp));
-            term_putstr(col + 5, row, 6, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[1].max_maxhp));
+                FormatBuffer<32>("%c", r_info[player_ptr->current_floor_ptr->m_list[1].r_idx].x_char).c_str());
+            term_putstr(col - 1, row, 5, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[1].hp).c_str());
+            term_putstr(col + 5, row, 6, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[1].max_maxhp).c_str());
         }
 
         if (MonsterRace(player_ptr->current_floor_ptr->m_list[2].r_idx).is_valid()) {
             term_putstr(col - 2, row + 1, 2, r_info[player_ptr->current_floor_ptr->m_list[2].r_idx].x_attr,
-                format("%c", r_info[player_ptr->current_floor_ptr->m_list[2].r_idx].x_char));
-            term_putstr(col - 1, row + 1, 5, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[2].hp));
-            term_putstr(col + 5, row + 1, 6, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[2].max_maxhp));
+                FormatBuffer<32>("%c", r_info[player_ptr->current_floor_ptr->m_list[2].r_idx].x_char).c_str());
+            term_putstr(col - 1, row + 1, 5, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[2].hp).c_str());
+            term_putstr(col + 5, row + 1, 6, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[2].max_maxhp).c_str());
         }
 
         if (MonsterRace(player_ptr->current_floor_ptr->m_list[3].r_idx).is_valid()) {
             term_putstr(col - 2, row + 2, 2, r_info[player_ptr->current_floor_ptr->m_list[3].r_idx].x_attr,
-                format("%c", r_info[player_ptr->current_floor_ptr->m_list[3].r_idx].x_char));
-            term_putstr(col - 1, row + 2, 5, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[3].hp));
-            term_putstr(col + 5, row + 2, 6, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[3].max_maxhp));
+                FormatBuffer<32>("%c", r_info[player_ptr->current_floor_ptr->m_list[3].r_idx].x_char).c_str());
+            term_putstr(col - 1, row + 2, 5, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[3].hp).c_str());
+            term_putstr(col + 5, row + 2, 6, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[3].max_maxhp).c_str());
         }
 
         if (MonsterRace(player_ptr->current_floor_ptr->m_list[4].r_idx).is_valid()) {
             term_putstr(col - 2, row + 3, 2, r_info[player_ptr->current_floor_ptr->m_list[4].r_idx].x_attr,
-                format("%c", r_info[player_ptr->current_floor_ptr->m_list[4].r_idx].x_char));
-            term_putstr(col - 1, row + 3, 5, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[4].hp));
-            term_putstr(col + 5, row + 3, 6, TERM_WHITE, format("%5d", player_ptr->current_floor_ptr->m_list[4].max_maxhp));
+                FormatBuffer<32>("%c", r_info[player_ptr->current_floor_ptr->m_list[4].r_idx].x_char).c_str());
+            term_putstr(col - 1, row + 3, 5, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[4].hp).c_str());
+            term_putstr(col + 5, row + 3, 6, TERM_WHITE, FormatBuffer<32>("%5d", player_ptr->current_floor_ptr->m_list[4].max_maxhp).c_str());
         }
 
         return;
@@ -165,7 +165,7 @@ void print_state(PlayerType *player_ptr)
             (void)sprintf(text, "  %2d", command_rep);
         }
 
-        c_put_str(attr, format("%5.5s", text), ROW_STATE, COL_STATE);
+        c_put_str(attr, FormatBuffer<32>("%5.5s", text).c_str(), ROW_STATE, COL_STATE);
         return;
     }
 
@@ -246,7 +246,7 @@ void print_state(PlayerType *player_ptr)
     }
     }
 
-    c_put_str(attr, format("%5.5s", text), ROW_STATE, COL_STATE);
+    c_put_str(attr, FormatBuffer<32>("%5.5s", text).c_str(), ROW_STATE, COL_STATE);
 }
 
 /*!
@@ -309,7 +309,7 @@ void print_speed(PlayerType *player_ptr)
         strcpy(buf, _("乗馬中", "Riding"));
     }
 
-    c_put_str(attr, format("%-9s", buf), row_speed, col_speed);
+    c_put_str(attr, FormatBuffer<32>("%-9s", buf).c_str(), row_speed, col_speed);
 }
 
 /*!
@@ -0,0 +1,163 @@
+﻿/*!
+ * @brief フロア生成の計測 / Floor generation benchmark
+ * @date 2026/10/19
+ * @details
+ * シードを固定したフロア生成を多数回繰り返し、フロア全体と部屋型ごとの所要時間の分布を出力する。
+ * コマンドラインからゲーム画面なしで実行することを想定している。
+ */
+
+#include "wizard/floor-generation-benchmark.h"
+#include "dungeon/dungeon.h"
+#include "floor/floor-generator.h"
+#include "game-option/input-options.h"
+#include "room/room-generator.h"
+#include "room/room-types.h"
+#include "system/floor-type-definition.h"
+#include "system/grid-type-definition.h"
+#include "system/monster-type-definition.h"
+#include "system/object-type-definition.h"
+#include "system/player-type-definition.h"
+#include "term/z-term.h"
+#include "world/world.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/*!
+ * @brief 部屋型の名前 (RoomType の並び順)
+ */
+const std::array<concptr, ROOM_TYPE_MAX> ROOM_TYPE_NAMES = { {
+    "NORMAL",
+    "OVERLAP",
+    "CROSS",
+    "INNER_FEAT",
+    "NEST",
+    "PIT",
+    "LESSER_VAULT",
+    "GREATER_VAULT",
+    "FRACAVE",
+    "RANDOM_VAULT",
+    "OVAL",
+    "CRYPT",
+    "TRAP_PIT",
+    "TRAP",
+    "GLASS",
+    "ARCADE",
+    "FIXED",
+} };
+
+/*!
+ * @brief 部屋型ごとの計測結果
+ */
+struct room_build_samples {
+    std::vector<double> usecs; //!< 生成1回ごとの所要時間 (マイクロ秒)
+    int built = 0; //!< 生成に成功した回数
+};
+
+/*!
+ * @brief 昇順に並べた標本からパーセンタイル値を求める (nearest-rank 法)
+ * @param sorted 昇順に並べた標本
+ * @param percent パーセント
+ * @return パーセンタイル値
+ */
+double percentile(const std::vector<double> &sorted, int percent)
+{
+    if (sorted.empty()) {
+        return 0.0;
+    }
+
+    auto rank = (sorted.size() * percent + 99) / 100;
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+/*!
+ * @brief 所要時間の分布を1行で出力する
+ * @param name 計測対象名
+ * @param samples 所要時間の標本 (並べ替える)
+ * @param built 成功回数
+ */
+void print_distribution(concptr name, std::vector<double> &samples, int built)
+{
+    std::sort(samples.begin(), samples.end());
+    printf("%-14s %8zu %8d %10.1f %10.1f %10.1f %10.1f\n", name, samples.size(), built,
+        percentile(samples, 50), percentile(samples, 90), percentile(samples, 99), samples.empty() ? 0.0 : samples.back());
+}
+
+}
+
+/*!
+ * @brief フロア生成の計測を行い、結果を標準出力へ書き出す
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param dungeon_idx ダンジョンID
+ * @param dun_level 階層
+ * @param count 生成するフロアの数
+ * @param seed 最初のフロアのシード (n 番目のフロアは seed + n)
+ * @return 計測できたならばTRUE
+ */
+bool output_floor_generation_benchmark(PlayerType *player_ptr, DUNGEON_IDX dungeon_idx, DEPTH dun_level, int count, uint32_t seed)
+{
+    if ((dungeon_idx <= 0) || (dungeon_idx >= static_cast<DUNGEON_IDX>(d_info.size())) || (dun_level <= 0) || (dun_level >= MAX_DEPTH) || (count <= 0)) {
+        return false;
+    }
+
+    /* 生成中の警告メッセージが -more- でキー入力待ちにならないよう、描画先のない端末を使う */
+    term_type headless_term;
+    term_init(&headless_term, 80, 24, 256);
+    term_activate(&headless_term);
+    const auto playing_backup = player_ptr->playing;
+    const auto skip_more_backup = skip_more;
+    player_ptr->playing = true;
+    skip_more = true;
+
+    auto floor_ptr = std::make_unique<floor_type>();
+    floor_ptr->o_list.assign(w_ptr->max_o_idx, {});
+    floor_ptr->m_list.assign(w_ptr->max_m_idx, {});
+    for (auto &list : floor_ptr->mproc_list) {
+        list.assign(w_ptr->max_m_idx, {});
+    }
+
+    floor_ptr->grid_array.assign(MAX_HGT, std::vector<grid_type>(MAX_WID));
+
+    std::array<room_build_samples, ROOM_TYPE_MAX> room_samples;
+    set_room_build_observer([&room_samples](RoomType type, bool is_built, std::chrono::nanoseconds elapsed) {
+        auto &samples = room_samples[enum2i(type)];
+        samples.usecs.push_back(elapsed.count() / 1000.0);
+        samples.built += is_built ? 1 : 0;
+    });
+
+    reset_floor_generation_stats();
+    std::vector<double> floor_usecs;
+    auto total_candidates = 0;
+    for (auto i = 0; i < count; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        total_candidates += generate_floor_with_seed(player_ptr, floor_ptr.get(), dungeon_idx, dun_level, seed + i);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        floor_usecs.push_back(elapsed.count() / 1000.0);
+    }
+
+    set_room_build_observer(nullptr);
+    skip_more = skip_more_backup;
+    player_ptr->playing = playing_backup;
+    term_nuke(&headless_term);
+
+    printf("Dungeon: %s (%d), Level: %d, Floors: %d, Seed: %u, Candidates: %d\n", d_info[dungeon_idx].name.data(), dungeon_idx, dun_level, count, seed, total_candidates);
+    printf("%-14s %8s %8s %10s %10s %10s %10s\n", "(usec)", "tries", "built", "p50", "p90", "p99", "max");
+    print_distribution("FLOOR", floor_usecs, count);
+    for (auto i = 0; i < ROOM_TYPE_MAX; i++) {
+        auto &samples = room_samples[i];
+        if (samples.usecs.empty()) {
+            continue;
+        }
+
+        print_distribution(ROOM_TYPE_NAMES[i], samples.usecs, samples.built);
+    }
+
+    printf("\n");
+    dump_floor_generation_stats(stdout);
+    return true;
+}
@@ -0,0 +1,6 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+class PlayerType;
+bool output_floor_generation_benchmark(PlayerType *player_ptr, DUNGEON_IDX dungeon_idx, DEPTH dun_level, int count, uint32_t seed);
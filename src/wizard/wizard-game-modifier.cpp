@@ -5,8 +5,14 @@
 
 #include "wizard/wizard-game-modifier.h"
 #include "core/asking-player.h"
+#include "core/player-update-profiler.h"
+#include "core/show-file.h"
 #include "dungeon/quest.h"
+#include "floor/floor-generator.h"
+#include "floor/grid-pair-cache.h"
 #include "info-reader/fixed-map-parser.h"
+#include "io-dump/dump-util.h"
+#include "io/files-util.h"
 #include "io/input-key-requester.h"
 #include "market/arena.h"
 #include "monster-race/monster-race.h"
@@ -18,6 +24,7 @@
 #include "system/player-type-definition.h"
 #include "system/system-variables.h"
 #include "term/screen-processor.h"
+#include "util/angband-files.h"
 #include "util/bit-flags-calculator.h"
 #include "util/int-char-converter.h"
 #include "view/display-messages.h"
@@ -31,6 +38,8 @@
 void wiz_enter_quest(PlayerType *player_ptr);
 void wiz_complete_quest(PlayerType *player_ptr);
 void wiz_restore_monster_max_num(MonsterRaceId r_idx);
+void wiz_show_update_profile(PlayerType *player_ptr);
+void wiz_dump_update_profile();
 
 /*!
  * @brief ゲーム設定コマンド一覧表
@@ -41,6 +50,9 @@ constexpr std::array wizard_game_modifier_menu_table = {
     std::make_tuple('Q', _("クエストに突入", "Enter quest")),
     std::make_tuple('u', _("ユニーク/ナズグルの生存数を復元", "Restore living info of unique/nazgul")),
     std::make_tuple('g', _("モンスター闘技場出場者更新", "Update gambling monster")),
+    std::make_tuple('p', _("更新処理の計測結果を表示", "Show update pass profile")),
+    std::make_tuple('P', _("更新処理の計測結果をファイルに出力", "Dump update pass profile")),
+    std::make_tuple('r', _("更新処理の計測結果を消去", "Reset update pass profile")),
 };
 
 /*!
@@ -86,9 +98,21 @@ void wizard_game_modifier(PlayerType *player_ptr)
     case 'q':
         wiz_complete_quest(player_ptr);
         break;
+    case 'p':
+        wiz_show_update_profile(player_ptr);
+        break;
+    case 'P':
+        wiz_dump_update_profile();
+        break;
     case 'Q':
         wiz_enter_quest(player_ptr);
         break;
+    case 'r':
+        PlayerUpdateProfiler::get_instance().reset();
+        reset_grid_pair_cache_stats();
+        reset_floor_generation_stats();
+        msg_print(_("更新処理の計測結果を消去しました。", "Update pass profile has been reset."));
+        break;
     case 'u':
         wiz_restore_monster_max_num(i2enum<MonsterRaceId>(command_arg));
         break;
@@ -189,3 +213,49 @@ void wiz_restore_monster_max_num(MonsterRaceId r_idx)
     msg_print(ss.str());
     msg_print(nullptr);
 }
+
+/*!
+ * @brief 更新処理の計測結果を画面に表示する
+ * @param player_ptr プレイヤーの情報へのポインタ
+ */
+void wiz_show_update_profile(PlayerType *player_ptr)
+{
+    FILE *fff = nullptr;
+    GAME_TEXT file_name[FILE_NAME_SIZE];
+    if (!open_temporary_file(&fff, file_name)) {
+        return;
+    }
+
+    PlayerUpdateProfiler::get_instance().dump(fff);
+    fprintf(fff, "\n");
+    dump_grid_pair_cache_stats(fff);
+    fprintf(fff, "\n");
+    dump_floor_generation_stats(fff);
+    angband_fclose(fff);
+    (void)show_file(player_ptr, true, file_name, _("更新処理の計測結果", "Update pass profile"), 0, 0);
+    fd_kill(file_name);
+}
+
+/*!
+ * @brief 更新処理の計測結果をユーザディレクトリのファイルに書き出す
+ */
+void wiz_dump_update_profile()
+{
+    char buf[1024];
+    path_build(buf, sizeof(buf), ANGBAND_DIR_USER, "update-profile.txt");
+    auto *fff = angband_fopen(buf, "w");
+    if (!fff) {
+        msg_format(_("%s を開けませんでした。", "Failed to open %s."), buf);
+        msg_print(nullptr);
+        return;
+    }
+
+    PlayerUpdateProfiler::get_instance().dump(fff);
+    fprintf(fff, "\n");
+    dump_grid_pair_cache_stats(fff);
+    fprintf(fff, "\n");
+    dump_floor_generation_stats(fff);
+    angband_fclose(fff);
+    msg_format(_("%s に出力しました。", "Dumped to %s."), buf);
+    msg_print(nullptr);
+}
@@ -238,6 +238,8 @@ void wiz_identify_full_inventory(PlayerType *player_ptr)
         set_bits(o_ptr->marked, OM_TOUCHED);
     }
 
+    invalidate_object_descriptions();
+
     /* Refrect item informaiton onto subwindows without updating inventory */
     reset_bits(player_ptr->update, PU_COMBINE | PU_REORDER);
     handle_stuff(player_ptr);
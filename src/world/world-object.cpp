@@ -1,16 +1,19 @@
 ﻿#include "world/world-object.h"
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
+#include "floor/geometry.h"
 #include "object-enchant/item-apply-magic.h"
 #include "object/object-kind.h"
 #include "object/tval-types.h"
 #include "system/alloc-entries.h"
 #include "system/floor-type-definition.h"
+#include "system/grid-type-definition.h"
 #include "system/object-type-definition.h"
 #include "system/player-type-definition.h"
 #include "util/probability-table.h"
 #include "view/display-messages.h"
 #include "world/world.h"
+#include <algorithm>
 #include <iterator>
 
 /*!
@@ -28,6 +31,7 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
         OBJECT_IDX i = floor_ptr->o_max;
         floor_ptr->o_max++;
         floor_ptr->o_cnt++;
+        floor_ptr->o_list_epoch++;
         return i;
     }
 
@@ -38,7 +42,7 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
             continue;
         }
         floor_ptr->o_cnt++;
-
+        floor_ptr->o_list_epoch++;
         return i;
     }
 
@@ -50,25 +54,112 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
 }
 
 /*!
- * @brief オブジェクト生成テーブルからアイテムを取得する /
- * Choose an object kind that seems "appropriate" to the given level
- * @param player_ptr プレイヤーへの参照ポインタ
- * @param level 生成階
- * @return 選ばれたオブジェクトベースID
+ * @brief 生きているアイテムの添字を昇順に並べた一覧を返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return 生きているアイテムの添字の一覧
  * @details
- * This function uses the "prob2" field of the "object allocation table",\n
- * and various local information, to calculate the "prob3" field of the\n
- * same table, which is then used to choose an "appropriate" object, in\n
- * a relatively efficient manner.\n
- *\n
- * It is (slightly) more likely to acquire an object of the given level\n
- * than one of a lower level.  This is done by choosing several objects\n
- * appropriate to the given level and keeping the "hardest" one.\n
- *\n
- * Note that if no objects are "appropriate", then this function will\n
- * fail, and return zero, but this should *almost* never happen.\n
+ * 空き番を読み飛ばすためのもの。アイテムの生成・削除・詰め直しがあった時 (o_list_epoch が進んだ時) だけ作り直す。
+ * 削除された直後の添字が残っていることがあるため、使う側でもアイテムが有効かを確かめること。
  */
-OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode)
+const std::vector<OBJECT_IDX> &get_live_object_indices(floor_type *floor_ptr)
+{
+    static std::vector<OBJECT_IDX> live_objects;
+    static uint32_t live_objects_epoch = 0;
+    static bool is_built = false;
+    if (is_built && (live_objects_epoch == floor_ptr->o_list_epoch)) {
+        return live_objects;
+    }
+
+    live_objects.clear();
+    for (OBJECT_IDX i = 1; i < floor_ptr->o_max; i++) {
+        if (floor_ptr->o_list[i].is_valid()) {
+            live_objects.push_back(i);
+        }
+    }
+
+    live_objects_epoch = floor_ptr->o_list_epoch;
+    is_built = true;
+    return live_objects;
+}
+
+/*!
+ * @brief 指定した矩形の中の床上にあるアイテムの添字を昇順に返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y1 矩形の上端のy座標
+ * @param x1 矩形の左端のx座標
+ * @param y2 矩形の下端のy座標
+ * @param x2 矩形の右端のx座標
+ * @return 該当するアイテムの添字の一覧 (モンスターが持っているものは除く)
+ * @details
+ * 矩形の各マスの o_idx_list を調べるため、手間はフロア上のアイテムの総数でなく矩形の広さに比例する。
+ * 矩形のマス数が生きているアイテムの数より多い場合は、生きているアイテムの一覧をたどる方が安いのでそちらを使う。
+ */
+std::vector<OBJECT_IDX> get_floor_objects_in_rect(floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
+{
+    y1 = std::max<POSITION>(y1, 0);
+    x1 = std::max<POSITION>(x1, 0);
+    y2 = std::min<POSITION>(y2, floor_ptr->height - 1);
+    x2 = std::min<POSITION>(x2, floor_ptr->width - 1);
+    std::vector<OBJECT_IDX> objects;
+    if ((y1 > y2) || (x1 > x2)) {
+        return objects;
+    }
+
+    const auto area = (y2 - y1 + 1) * (x2 - x1 + 1);
+    if (area > floor_ptr->o_cnt) {
+        for (const auto o_idx : get_live_object_indices(floor_ptr)) {
+            const auto &item = floor_ptr->o_list[o_idx];
+            if (item.is_valid() && !item.is_held_by_monster() && (item.iy >= y1) && (item.iy <= y2) && (item.ix >= x1) && (item.ix <= x2)) {
+                objects.push_back(o_idx);
+            }
+        }
+
+        return objects;
+    }
+
+    for (auto y = y1; y <= y2; y++) {
+        for (auto x = x1; x <= x2; x++) {
+            for (const auto o_idx : floor_ptr->grid_array[y][x].o_idx_list) {
+                if (floor_ptr->o_list[o_idx].is_valid()) {
+                    objects.push_back(o_idx);
+                }
+            }
+        }
+    }
+
+    std::sort(objects.begin(), objects.end());
+    return objects;
+}
+
+/*!
+ * @brief 指定地点から一定距離以内の床上にあるアイテムの添字を昇順に返す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y 中心のy座標
+ * @param x 中心のx座標
+ * @param range 距離
+ * @return 該当するアイテムの添字の一覧 (モンスターが持っているものは除く)
+ * @details 距離は縦横の差の大きい方を下回らないので、一辺 range * 2 + 1 の矩形から絞り込む
+ */
+std::vector<OBJECT_IDX> get_floor_objects_in_range(floor_type *floor_ptr, POSITION y, POSITION x, POSITION range)
+{
+    auto objects = get_floor_objects_in_rect(floor_ptr, y - range, x - range, y + range, x + range);
+    const auto is_out_of_range = [floor_ptr, y, x, range](OBJECT_IDX o_idx) {
+        const auto &item = floor_ptr->o_list[o_idx];
+        return distance(y, x, item.iy, item.ix) > range;
+    };
+
+    objects.erase(std::remove_if(objects.begin(), objects.end(), is_out_of_range), objects.end());
+    return objects;
+}
+
+/*!
+ * @brief アイテムの生成階を決める
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param level 基本の生成階
+ * @return 生成階
+ * @details 一定の確率で基本の生成階より深い階のアイテムを生成する
+ */
+static DEPTH decide_obj_num_level(PlayerType *player_ptr, DEPTH level)
 {
     if (level > MAX_DEPTH - 1) {
         level = MAX_DEPTH - 1;
@@ -80,7 +171,17 @@ OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode)
         }
     }
 
-    // 候補の確率テーブル生成
+    return level;
+}
+
+/*!
+ * @brief 生成階に応じたアイテム候補の確率テーブルを作る
+ * @param level 生成階
+ * @param mode 生成オプション
+ * @return 候補の確率テーブル (項目はオブジェクト生成テーブルの添字)
+ */
+static ProbabilityTable<int> make_obj_num_table(DEPTH level, BIT_FLAGS mode)
+{
     ProbabilityTable<int> prob_table;
     for (auto i = 0U; i < alloc_kind_table.size(); i++) {
         const auto &entry = alloc_kind_table[i];
@@ -98,6 +199,16 @@ OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode)
         prob_table.entry_item(i, entry.prob2);
     }
 
+    return prob_table;
+}
+
+/*!
+ * @brief 確率テーブルからアイテムを選ぶ
+ * @param prob_table 候補の確率テーブル
+ * @return 選ばれたオブジェクトベースID
+ */
+static OBJECT_IDX choose_obj_num(const ProbabilityTable<int> &prob_table)
+{
     // 候補なし
     if (prob_table.empty()) {
         return 0;
@@ -121,3 +232,56 @@ OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode)
 
     return alloc_kind_table[*it].index;
 }
+
+/*!
+ * @brief オブジェクト生成テーブルからアイテムを取得する /
+ * Choose an object kind that seems "appropriate" to the given level
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param level 生成階
+ * @return 選ばれたオブジェクトベースID
+ * @details
+ * This function uses the "prob2" field of the "object allocation table",\n
+ * and various local information, to calculate the "prob3" field of the\n
+ * same table, which is then used to choose an "appropriate" object, in\n
+ * a relatively efficient manner.\n
+ *\n
+ * It is (slightly) more likely to acquire an object of the given level\n
+ * than one of a lower level.  This is done by choosing several objects\n
+ * appropriate to the given level and keeping the "hardest" one.\n
+ *\n
+ * Note that if no objects are "appropriate", then this function will\n
+ * fail, and return zero, but this should *almost* never happen.\n
+ */
+OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode)
+{
+    level = decide_obj_num_level(player_ptr, level);
+    return choose_obj_num(make_obj_num_table(level, mode));
+}
+
+/*!
+ * @brief 候補テーブルを使い回すアイテム選択器を作る
+ * @param mode 生成オプション
+ * @details 生成制約 (オブジェクト生成テーブルの prob2) を変えない間だけ使うこと
+ */
+ObjectKindSelector::ObjectKindSelector(BIT_FLAGS mode)
+    : mode(mode)
+{
+}
+
+/*!
+ * @brief 生成階ごとの候補テーブルを使い回してアイテムを選ぶ
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param level 生成階
+ * @return 選ばれたオブジェクトベースID
+ * @details 乱数の消費も含め、get_obj_num() と同じ結果になる
+ */
+OBJECT_IDX ObjectKindSelector::get_obj_num(PlayerType *player_ptr, DEPTH level)
+{
+    level = decide_obj_num_level(player_ptr, level);
+    auto it = this->tables.find(level);
+    if (it == this->tables.end()) {
+        it = this->tables.emplace(level, make_obj_num_table(level, this->mode)).first;
+    }
+
+    return choose_obj_num(it->second);
+}
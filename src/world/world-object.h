@@ -1,8 +1,27 @@
 ﻿#pragma once
 
 #include "system/angband.h"
+#include "util/probability-table.h"
+#include <map>
+#include <vector>
 
 struct floor_type;
 class PlayerType;
 OBJECT_IDX o_pop(floor_type *floor_ptr);
+const std::vector<OBJECT_IDX> &get_live_object_indices(floor_type *floor_ptr);
+std::vector<OBJECT_IDX> get_floor_objects_in_rect(floor_type *floor_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2);
+std::vector<OBJECT_IDX> get_floor_objects_in_range(floor_type *floor_ptr, POSITION y, POSITION x, POSITION range);
 OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level, BIT_FLAGS mode);
+
+/*!
+ * @brief 同じ生成制約のもとで続けてアイテムを選ぶ時に、生成階ごとの候補テーブルを使い回す
+ */
+class ObjectKindSelector {
+public:
+    ObjectKindSelector(BIT_FLAGS mode);
+    OBJECT_IDX get_obj_num(PlayerType *player_ptr, DEPTH level);
+
+private:
+    BIT_FLAGS mode; //!< 生成オプション
+    std::map<DEPTH, ProbabilityTable<int>> tables; //!< 生成階ごとの候補テーブル
+};